@@ -0,0 +1,93 @@
+/**
+ * @file allocount.c
+ * @author Joseph Allred
+ * @brief Counting allocator hooks used by the tests and benches 
+ * @date 2026-10-19
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "allocount.h"
+
+// every block is prefixed with its requested size, padded to keep alignment 
+typedef union AllocHeader {
+    size_t size; 
+    max_align_t align; 
+} AllocHeader; 
+
+static AllocCount counts = { 0, 0, 0, 0 }; 
+static long failAfter = -1;    // allocations left before failing, -1 never fails 
+
+/**
+ * @brief Allocates a block and records it in the counters.
+ * 
+ * @param size The number of bytes requested
+ * @return     The block, or NULL if allocation failed or was set to fail
+ */
+void* AllocCount_malloc(size_t size) {
+
+    if (failAfter == 0) {
+        return NULL; 
+    }
+    if (failAfter > 0) {
+        failAfter -= 1; 
+    }
+    AllocHeader* header = (AllocHeader*)malloc(sizeof(AllocHeader) + size); 
+    if (header == NULL) {
+        return NULL; 
+    }
+    header->size = size; 
+    counts.liveBlocks += 1; 
+    counts.liveBytes += (long)size; 
+    counts.totalBlocks += 1; 
+    if (counts.liveBytes > counts.peakBytes) {
+        counts.peakBytes = counts.liveBytes; 
+    }
+    return header + 1; 
+}
+
+/**
+ * @brief Frees a block from AllocCount_malloc and removes it from the counters.
+ * 
+ * @param ptr The block to be freed, may be NULL
+ */
+void AllocCount_free(void* ptr) {
+
+    if (ptr == NULL) {
+        return; 
+    }
+    AllocHeader* header = (AllocHeader*)ptr - 1; 
+    counts.liveBlocks -= 1; 
+    counts.liveBytes -= (long)header->size; 
+    free(header); 
+}
+
+/**
+ * @brief Returns the current counters.
+ * 
+ * @return A copy of the counters
+ */
+AllocCount AllocCount_get(void) {
+    return counts; 
+}
+
+/**
+ * @brief Restarts the peak and total counters from the current live values.
+ * 
+ * Live counters are kept, since blocks allocated earlier may still be freed.
+ */
+void AllocCount_reset(void) {
+    counts.peakBytes = counts.liveBytes; 
+    counts.totalBlocks = 0; 
+    failAfter = -1; 
+}
+
+/**
+ * @brief Makes every allocation after the next count allocations fail.
+ * 
+ * @param count Allocations still allowed to succeed, -1 to never fail
+ */
+void AllocCount_fail_after(long count) {
+    failAfter = count; 
+}
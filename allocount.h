@@ -0,0 +1,31 @@
+/**
+ * @file allocount.h
+ * @author Joseph Allred 
+ * @brief Counting allocator hooks used by the tests and benches 
+ * @date 2026-10-19
+ */
+
+#ifndef COMP230_ALLOCOUNT_H
+#define COMP230_ALLOCOUNT_H
+
+#include <stdlib.h>
+#include <stdio.h>
+
+// definition for AllocCount, a snapshot of the counters 
+typedef struct AllocCount {
+    long liveBlocks;        // blocks allocated and not yet freed 
+    long liveBytes;         // bytes requested by those blocks 
+    long peakBytes;         // largest value of liveBytes since the last reset 
+    long totalBlocks;       // blocks allocated since the last reset 
+} AllocCount; 
+
+// hooks to be passed to List_set_allocator 
+void* AllocCount_malloc(size_t size);
+void AllocCount_free(void* ptr);
+
+// counters and failure injection 
+AllocCount AllocCount_get(void);
+void AllocCount_reset(void);
+void AllocCount_fail_after(long count);
+
+#endif /* COMP230_ALLOCOUNT_H */
@@ -12,6 +12,28 @@
 
 #include "linklist.h"
 
+// diagnostic hook used by the logging methods, NULL keeps them silent 
+static List_diag_fn diag_fn = NULL; 
+
+// allocator used for every Node and List, replaceable with List_set_allocator 
+static List_alloc_fn alloc_fn = malloc; 
+static List_free_fn free_fn = free; 
+
+/**
+ * @brief Records a failed operation for the logging methods.
+ * 
+ * Sets errno and forwards a readable message to the diagnostic hook when one 
+ * has been installed with List_set_diag. No I/O happens otherwise.
+ * 
+ * @param status The failure to be reported
+ */
+static void List_report(ListStatus status) {
+    errno = 1; 
+    if (diag_fn != NULL) {
+        diag_fn(status, List_strstatus(status)); 
+    }
+}
+
 /**
  * @brief Initialize an existing Node pointer.
  * 
@@ -32,10 +54,13 @@ void init_Node(Node* node, int data) {
  * Nodes constructed using this function should be cleaned up using delete_Node
  * 
  * @param data  The value to be stored in this node
+ * @return Node* to the new node, or NULL if allocation failed
  */
 Node* new_Node(int data) {
-    Node* node = (Node*)malloc(sizeof(Node));
-    init_Node(node, data); 
+    Node* node = (Node*)alloc_fn(sizeof(Node));
+    if (node != NULL) {
+        init_Node(node, data); 
+    }
     return node; 
 }
 
@@ -45,32 +70,33 @@ Node* new_Node(int data) {
  * @param node  The node to be deleted
  */
 void delete_Node(Node* node) {
-    node->data = 0;
-    node = NULL; 
-    free(node); 
+    free_fn(node); 
 }
 
 /**
  * @brief Initialize a list that already exists in memory.
  * 
  * When a list is initialized its length should be set to 0 and the 
- * head node should be set to NULL.
+ * head and tail nodes should be set to NULL.
  * 
  * @param list the list to be initialized
  */
 void init_List(List* list) {
     list->length = 0;
     list->head = NULL; 
+    list->tail = NULL; 
 }
 
 /**
  * @brief Allocate memory and create a new empty list.
  * Lists constructed using this function should be cleaned up using delete_List
- * @return List* to the newly created list
+ * @return List* to the newly created list, or NULL if allocation failed
  */
 List* new_List() {
-    List* list = (List*)malloc(sizeof(List)); 
-    init_List(list); 
+    List* list = (List*)alloc_fn(sizeof(List)); 
+    if (list != NULL) {
+        init_List(list); 
+    }
     return list; 
 }
 
@@ -85,8 +111,7 @@ void delete_List(List* list) {
         list->head = list->head->next; 
         delete_Node(temp);  // delete node AFTER head-pointer has moved to the next node 
     }
-    free(list->head); 
-    free(list); 
+    free_fn(list); 
 }
 
 /**
@@ -117,24 +142,26 @@ void List_print(List* list) {
  * list and the length of the list should increase by one. This should function 
  * the same as the add method of Java's LinkedList with no index argument.
  * 
+ * If no node can be allocated the list is left unchanged and the failure is 
+ * reported like those of List_insert.
+ * 
  * @param list The list to which a value should be appended.
  * @param data  The value to be appended to the list
  */
 void List_append(List* list, int data) {
 
     Node* newNode = new_Node(data); //make a new Node with the given data 
-    Node* temp = list->head; 
-
-        if (temp == NULL) { // check for an empty list 
-            list->head = newNode; 
-        } else {
-            while(temp->next != NULL) { //move to the last Node in the list 
-            temp = temp->next; 
-            }
-            temp->next = newNode; // Replace NULL with the newly created Node 
-        }
+    if (newNode == NULL) {
+        List_report(LIST_ERR_NOMEM); 
+        return; 
+    }
 
-    newNode->next = NULL; // Assign NULL to the next pointer of the last Node in list 
+    if (list->tail == NULL) { // check for an empty list 
+        list->head = newNode; 
+    } else {
+        list->tail->next = newNode; // Replace NULL with the newly created Node 
+    }
+    list->tail = newNode; // the new Node is now the last Node in list 
     list->length += 1; // increase length to reflect new size of list 
 }
 
@@ -146,13 +173,23 @@ void List_append(List* list, int data) {
  * should follow the new one maintaining their order. This should function the 
  * same as the add method of Java's LinkedList with 0 as the index argument.
  * 
+ * If no node can be allocated the list is left unchanged and the failure is 
+ * reported like those of List_insert.
+ * 
  * @param node The list to which the value will be appended.
  * @param data The value to be prepended to the list
  */
 void List_prepend(List* list, int data) {
     Node* newNode = new_Node(data); // create a new Node with the given data 
+    if (newNode == NULL) {
+        List_report(LIST_ERR_NOMEM); 
+        return; 
+    }
     newNode->next = list->head; // assign new Node's next-pointer to the head of the list 
     list->head = newNode; // assign the head-pointer to the newly appended Node 
+    if (list->tail == NULL) {
+        list->tail = newNode; // first Node of an empty list is also its last 
+    }
     list->length += 1; // update length of list 
 }
 
@@ -161,26 +198,14 @@ void List_prepend(List* list, int data) {
  * 
  * When a list is extended with another list, all the elements in the second 
  * list are effectively appended to the first list. These elements maintain the 
- * same order they had in their original list. This should NOT be done using 
- * nested loops and repeated calls to List_append since that is terribly 
- * inefficient.
+ * same order they had in their original list. The nodes are moved, not copied, 
+ * so list B is left empty and no node is ever owned by both lists.
  * 
  * @param listA The list to be extended
  * @param listB The list to be added to the end of list A
  */
 void List_extend(List* listA, List* listB) {
-
-    if (listA->head == NULL) {
-        listA->head = listB->head; // if listB is empty, this listA's head-pointer will just be reassigned to NULL
-    }
-    else {
-        Node* temp = listA->head; 
-        while(temp->next != NULL) {
-            temp = temp->next; // move temp pointer to the last node before the NULL terminator 
-        }
-        temp->next = listB->head; // attach listA to the beginning of listB  HERE*****
-    }
-    listA->length += listB->length; // if listB is empty, listA's length will remain the same 
+    List_concat(listA, listB); 
 }
 
 /**
@@ -210,39 +235,22 @@ bool List_contains(List* list, int value) {
 /**
  * @brief Returns the value of the ith node in the list.
  * 
+ * On failure errno is set, the diagnostic hook (if any) is notified, and 0 is 
+ * returned. Use List_try_get to tell a stored 0 apart from an error.
+ * 
  * @param list  The list to be indexed for the element
  * @param index The index of the node to be retrieved
  * @return      The value in the node at the index
  */
 int List_get(List* list, int index) {
 
-    Node* temp = list->head; 
-    if (temp == NULL) {
-        errno = 1; 
-        perror("Empty list");
-        return 0; 
-    } 
-    else if (index < 0 || index >= list->length) {
-        errno = 1;
-        perror("Index out of bounds"); 
+    int value = 0; 
+    ListStatus status = List_try_get(list, index, &value); 
+    if (status != LIST_OK) {
+        List_report(status); 
         return 0; 
-    } 
-    int cntr = 0; 
-    int whileCntr = 0; 
-    while (cntr < list->length && whileCntr < 40) {
-        if (cntr == index) {
-            return temp->data; 
-        }
-        temp = temp->next; // move the pointer along the list 
-        cntr += 1; // increment pointer to match new location 
-        whileCntr++; 
-    }
-    if (whileCntr == 40) {
-        printf("Get while-loop failed\n");
     }
-    errno = 1; 
-    perror("Unknown error"); 
-    return 0; 
+    return value; 
 }
 
 /**
@@ -260,36 +268,11 @@ int List_get(List* list, int index) {
  */
 int List_insert(List* list, int index, int value) {
 
-    Node* temp = list->head;  
-    Node* newNode = new_Node(value); // create new node, construct with given value 
-
-    if (list->length == 0)  {
-        if(index != 0) { // empty lists can only insert at 0
-            printf("Empty List only supports insertion at index 0\n");
-            return 1; 
-        } else {
-            newNode->next = temp; 
-            list->head = newNode; 
-            list->length += 1; 
-            return 0; 
-        }
-    }
-    /* allows insertion at index one greater than last index (e.g., a list 
-    with ten elements allows insertion at index 10 but not at index 11) */
-    if (index < 0 || index > list->length) { 
-        printf("Index out of bounds\n"); 
+    ListStatus status = List_try_insert(list, index, value); 
+    if (status != LIST_OK) {
+        List_report(status); 
         return 1; 
     }
-        
-    Node* prev = NULL;
-    for (int i = 0; i < index; i++) {
-        prev = temp; 
-        temp = temp->next; 
-    }
-    // rearrange pointer nodes surrounding the new node 
-    prev->next = newNode; 
-    newNode->next = temp;
-    list->length += 1; //  update length of list 
     return 0; 
 }
 
@@ -298,7 +281,8 @@ int List_insert(List* list, int index, int value) {
  * 
  * This function will remove the Node at the specified index from the list, 
  * safely free the memory allocated for that node, and return the value stored 
- * in that node.
+ * in that node. On failure errno is set, the diagnostic hook (if any) is 
+ * notified, and 1 is returned.
  * 
  * @param list  The list from which a node will be removed
  * @param index The index of the node to be removed
@@ -306,37 +290,12 @@ int List_insert(List* list, int index, int value) {
  */
 int List_remove(List* list, int index) {
 
-    // error handling 
-    if (list->head == NULL) {
-        errno = 1; 
-        perror("Cannot remove from empty list"); 
-        return 1; 
-    }
-    if (index < 0 || index > (list->length-1)) {
-        errno = 1; 
-        perror("Index out bounds");
-        return 1; 
-    }
-
-    Node* temp = list->head; 
-    Node* prev = NULL; 
     int retVal = 0; 
-
-    for (int i = 0; i < list->length; i++) {
-        if (i == index) {
-            break; // loop until finding specific index 0 1 2 3 
-        }
-        prev = temp; 
-        temp = temp->next; 
-    }
-    retVal = temp->data; // save the data before deleting node 
-    if (index == 0) {
-        list->head = list->head->next; // reassign head pointer to drop first node in list 
-    } else {
-        prev->next = temp->next; // reattach pointer to delete node in the middle of list 
+    ListStatus status = List_try_remove(list, index, &retVal); 
+    if (status != LIST_OK) {
+        List_report(status); 
+        return 1; 
     }
-    delete_Node(temp); // free memory;
-    list->length -= 1; // update size of list 
     return retVal; 
 }
 
@@ -359,5 +318,260 @@ void List_clear(List* list) {
         delete_Node(remove); // delete node after pointer has moved on to next node 
     }
     list->head = NULL; // reset head-pointer 
-    list->length == 0; // update size of list 
-}
\ No newline at end of file
+    list->tail = NULL; 
+    list->length = 0; // update size of list 
+}
+
+/**
+ * @brief Retrieves the value of the ith node without logging.
+ * 
+ * @param list  The list to be indexed for the element
+ * @param index The index of the node to be retrieved
+ * @param out   Receives the value in the node, untouched on failure
+ * @return      LIST_OK, LIST_ERR_EMPTY or LIST_ERR_INDEX
+ */
+ListStatus List_try_get(List* list, int index, int* out) {
+
+    if (list->head == NULL) {
+        return LIST_ERR_EMPTY; 
+    }
+    if (index < 0 || index >= list->length) {
+        return LIST_ERR_INDEX; 
+    }
+    Node* temp = list->head; 
+    for (int i = 0; i < index; i++) {
+        temp = temp->next; // move the pointer along the list 
+    }
+    *out = temp->data; 
+    return LIST_OK; 
+}
+
+/**
+ * @brief Inserts a new value at the given index without logging.
+ * 
+ * The index is validated before any memory is allocated, so a rejected insert 
+ * never leaves a stray node behind. Valid indices run from 0 to length.
+ * 
+ * @param list  The list into which the value will be inserted
+ * @param index The index where the new value should be inserted
+ * @param value The value to be inserted into the list
+ * @return      LIST_OK, LIST_ERR_INDEX or LIST_ERR_NOMEM
+ */
+ListStatus List_try_insert(List* list, int index, int value) {
+
+    if (index < 0 || index > list->length) {
+        return LIST_ERR_INDEX; 
+    }
+    Node* newNode = new_Node(value); // only allocate once the index is known to be good 
+    if (newNode == NULL) {
+        return LIST_ERR_NOMEM; 
+    }
+    if (index == 0) {
+        newNode->next = list->head; 
+        list->head = newNode; 
+        if (list->tail == NULL) {
+            list->tail = newNode; 
+        }
+    } else {
+        Node* prev = list->head; 
+        for (int i = 1; i < index; i++) {
+            prev = prev->next; // stop on the node before the insertion point 
+        }
+        newNode->next = prev->next; 
+        prev->next = newNode; 
+        if (prev == list->tail) {
+            list->tail = newNode; // inserted at index length 
+        }
+    }
+    list->length += 1; // update length of list 
+    return LIST_OK; 
+}
+
+/**
+ * @brief Removes the node at the given index without logging.
+ * 
+ * @param list  The list from which a node will be removed
+ * @param index The index of the node to be removed
+ * @param out   Receives the removed value, may be NULL to discard it
+ * @return      LIST_OK, LIST_ERR_EMPTY or LIST_ERR_INDEX
+ */
+ListStatus List_try_remove(List* list, int index, int* out) {
+
+    if (list->head == NULL) {
+        return LIST_ERR_EMPTY; 
+    }
+    if (index < 0 || index >= list->length) {
+        return LIST_ERR_INDEX; 
+    }
+    Node* temp = list->head; 
+    Node* prev = NULL; 
+    for (int i = 0; i < index; i++) {
+        prev = temp; 
+        temp = temp->next; 
+    }
+    if (prev == NULL) {
+        list->head = temp->next; // drop first node in list 
+    } else {
+        prev->next = temp->next; // reattach pointers around the removed node 
+    }
+    if (temp == list->tail) {
+        list->tail = prev; // NULL again once the last node is gone 
+    }
+    if (out != NULL) {
+        *out = temp->data; // save the data before deleting node 
+    }
+    delete_Node(temp); 
+    list->length -= 1; // update size of list 
+    return LIST_OK; 
+}
+
+/**
+ * @brief Returns a short, human readable description of a status code.
+ * 
+ * @param status The status code to be described
+ * @return       A static string, never NULL
+ */
+const char* List_strstatus(ListStatus status) {
+    switch (status) {
+        case LIST_OK:        return "Success"; 
+        case LIST_ERR_EMPTY: return "Empty list"; 
+        case LIST_ERR_INDEX: return "Index out of bounds"; 
+        case LIST_ERR_NOMEM: return "Out of memory"; 
+        case LIST_ERR_FULL:  return "Container full"; 
+    }
+    return "Unknown error"; 
+}
+
+/**
+ * @brief Installs the diagnostic hook used by List_get, List_insert and 
+ * List_remove when they fail.
+ * 
+ * Diagnostics are off by default. Pass NULL to turn them off again.
+ * 
+ * @param fn The hook to be called, or NULL
+ */
+void List_set_diag(List_diag_fn fn) {
+    diag_fn = fn; 
+}
+
+/**
+ * @brief Moves every node of list B onto the end of list A in constant time.
+ * 
+ * Ownership of the nodes is transferred to list A and list B is reset to an 
+ * empty list, so both lists can later be deleted independently.
+ * 
+ * @param listA The list to be extended
+ * @param listB The list whose nodes are moved, empty afterwards
+ */
+void List_concat(List* listA, List* listB) {
+
+    if (listA == listB || listB->head == NULL) {
+        return; // nothing to move 
+    }
+    if (listA->tail == NULL) {
+        listA->head = listB->head; 
+    } else {
+        listA->tail->next = listB->head; // link the last node of A to the first node of B 
+    }
+    listA->tail = listB->tail; 
+    listA->length += listB->length; 
+    init_List(listB); // listB no longer owns any nodes 
+}
+
+/**
+ * @brief Splits a list in two at the given index.
+ * 
+ * Every node from index onwards is moved to the end of out, leaving the first 
+ * index nodes in list. Walking to the cut point is O(index); the transfer 
+ * itself is constant time. An index equal to the length moves nothing.
+ * 
+ * @param list  The list to be cut
+ * @param index The index of the first node to be moved
+ * @param out   The list receiving the moved nodes, may not be list
+ * @return      LIST_OK or LIST_ERR_INDEX
+ */
+ListStatus List_split_at(List* list, int index, List* out) {
+
+    if (index < 0 || index > list->length) {
+        return LIST_ERR_INDEX; 
+    }
+    if (index == list->length) {
+        return LIST_OK; 
+    }
+    Node* prev = NULL; 
+    Node* first = list->head; 
+    for (int i = 0; i < index; i++) {
+        prev = first; 
+        first = first->next; 
+    }
+    return List_splice(out, out->tail, list, prev, list->tail, list->length - index); 
+}
+
+/**
+ * @brief Moves a run of nodes from one list into another in constant time.
+ * 
+ * The run starts at the node following prev in src (the head of src when prev 
+ * is NULL), ends at last, and must hold exactly count nodes. It is unlinked 
+ * from src and relinked into dst right after pos (at the front of dst when pos 
+ * is NULL). Both lengths are adjusted using count, so no node is ever visited; 
+ * passing src->tail and src->length with a NULL prev moves the whole list.
+ * 
+ * @param dst   The list receiving the nodes
+ * @param pos   The node of dst to insert after, or NULL for the front
+ * @param src   The list losing the nodes, may not be dst
+ * @param prev  The node of src before the run, or NULL if it starts at head
+ * @param last  The last node of the run
+ * @param count The number of nodes in the run
+ * @return      LIST_OK, LIST_ERR_EMPTY or LIST_ERR_INDEX
+ */
+ListStatus List_splice(List* dst, Node* pos, List* src, Node* prev, Node* last, int count) {
+
+    if (src->head == NULL) {
+        return LIST_ERR_EMPTY; 
+    }
+    if (src == dst || last == NULL || count <= 0 || count > src->length) {
+        return LIST_ERR_INDEX; 
+    }
+    Node* first = (prev == NULL) ? src->head : prev->next; 
+
+    // unlink first..last from src 
+    if (prev == NULL) {
+        src->head = last->next; 
+    } else {
+        prev->next = last->next; 
+    }
+    if (last == src->tail) {
+        src->tail = prev; 
+    }
+    src->length -= count; 
+
+    // link first..last into dst after pos 
+    if (pos == NULL) {
+        last->next = dst->head; 
+        dst->head = first; 
+    } else {
+        last->next = pos->next; 
+        pos->next = first; 
+    }
+    if (pos == dst->tail) {
+        dst->tail = last; // also covers an empty dst, where both are NULL 
+    }
+    dst->length += count; 
+    return LIST_OK; 
+}
+
+/**
+ * @brief Replaces the allocator used for every Node and List.
+ * 
+ * Intended for memory accounting and failure injection in tests and benches. 
+ * Install it before any list is created, or make sure the new free function can 
+ * release blocks obtained from the previous allocator. Passing NULL for either 
+ * function restores malloc or free.
+ * 
+ * @param allocFn The function used to allocate nodes and lists, or NULL
+ * @param freeFn  The function used to free them, or NULL
+ */
+void List_set_allocator(List_alloc_fn allocFn, List_free_fn freeFn) {
+    alloc_fn = (allocFn != NULL) ? allocFn : malloc; 
+    free_fn = (freeFn != NULL) ? freeFn : free; 
+}
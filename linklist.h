@@ -25,8 +25,25 @@ typedef struct Node {
 typedef struct List { 
     int length; 
     Node* head; 
+    Node* tail; 
 } List; 
 
+// status codes returned by the non-logging List_try_* methods 
+typedef enum ListStatus {
+    LIST_OK = 0,        // operation succeeded 
+    LIST_ERR_EMPTY,     // list has no nodes 
+    LIST_ERR_INDEX,     // index out of bounds 
+    LIST_ERR_NOMEM,     // node allocation failed 
+    LIST_ERR_FULL       // bounded container has no free slot 
+} ListStatus; 
+
+// optional diagnostic hook, called with a message when a logging method fails 
+typedef void (*List_diag_fn)(ListStatus status, const char* msg);
+
+// optional allocator hooks for every Node and List, malloc and free by default 
+typedef void* (*List_alloc_fn)(size_t size);
+typedef void (*List_free_fn)(void* ptr);
+
 // Node constructor methods 
 void init_Node(Node* node, int data);
 Node* new_Node(int data);
@@ -49,5 +66,22 @@ int List_insert(List* list, int index, int value);
 int List_remove(List* list, int index);
 void List_clear(List* list);
 
+// non-logging methods, report failure through a status code only 
+ListStatus List_try_get(List* list, int index, int* out);
+ListStatus List_try_insert(List* list, int index, int value);
+ListStatus List_try_remove(List* list, int index, int* out);
+const char* List_strstatus(ListStatus status);
+
+// ownership-transferring methods, the source list gives up the moved nodes 
+void List_concat(List* listA, List* listB);
+ListStatus List_split_at(List* list, int index, List* out);
+ListStatus List_splice(List* dst, Node* pos, List* src, Node* prev, Node* last, int count);
+
+// diagnostics for the logging methods, off (NULL) unless a hook is installed 
+void List_set_diag(List_diag_fn fn);
+
+// allocator used for nodes and lists, NULL restores malloc/free 
+void List_set_allocator(List_alloc_fn allocFn, List_free_fn freeFn);
+
 #endif /* COMP230_LINKLIST_H */
     
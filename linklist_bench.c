@@ -0,0 +1,104 @@
+/**
+ * @file linklist_bench.c
+ * @author Joseph Allred 
+ * @brief memory cost per element of each operation in linklist.c 
+ * @date 2026-10-19 
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "linklist.h"
+#include "allocount.h"
+
+#define BENCH_COUNT 1000000
+#define BENCH_INSERT_COUNT 20000    // middle inserts are O(n) each 
+
+long startLive = 0;     // live bytes when the current operation started 
+double startTime = 0.0; 
+
+double now(void);
+void begin(void);
+void report(const char* name, int count);
+
+int main(int argc, char* argv[]) {
+
+    List_set_allocator(AllocCount_malloc, AllocCount_free); 
+    printf("%-28s %9s %9s %12s %12s %10s\n", "operation", "elements", "allocs", "live B/elem", "peak B/elem", "ms");
+
+    List* list = new_List(); 
+    begin(); 
+    for (int i = 0; i < BENCH_COUNT; i++) {
+        List_append(list, i); 
+    }
+    report("List_append", BENCH_COUNT); 
+
+    List* other = new_List(); 
+    begin(); 
+    for (int i = 0; i < BENCH_COUNT; i++) {
+        List_prepend(other, i); 
+    }
+    report("List_prepend", BENCH_COUNT); 
+
+    begin(); 
+    List_concat(list, other); 
+    report("List_concat", BENCH_COUNT); 
+
+    begin(); 
+    List_split_at(list, BENCH_COUNT, other); 
+    report("List_split_at", BENCH_COUNT); 
+
+    begin(); 
+    int value = 0; 
+    for (int i = 0; i < BENCH_COUNT; i++) {
+        List_try_remove(other, 0, &value); 
+    }
+    report("List_try_remove(0)", BENCH_COUNT); 
+
+    begin(); 
+    List_clear(list); 
+    report("List_clear", BENCH_COUNT); 
+
+    begin(); 
+    for (int i = 0; i < BENCH_INSERT_COUNT; i++) {
+        List_try_insert(list, list->length / 2, i); 
+    }
+    report("List_try_insert(middle)", BENCH_INSERT_COUNT); 
+
+    begin(); 
+    for (int i = 0; i < BENCH_INSERT_COUNT; i++) {
+        List_try_insert(list, list->length + 1, i); // rejected before allocating 
+    }
+    report("List_try_insert(bad index)", BENCH_INSERT_COUNT); 
+
+    delete_List(list); 
+    delete_List(other); 
+    AllocCount counts = AllocCount_get(); 
+    printf("\nleft allocated after delete_List: %ld blocks, %ld bytes\n", counts.liveBlocks, counts.liveBytes);
+    printf("sizeof(Node) = %zu, sizeof(List) = %zu, int payload = %zu\n", sizeof(Node), sizeof(List), sizeof(int));
+    return (counts.liveBlocks == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+double now(void) {
+    struct timespec ts; 
+    clock_gettime(CLOCK_MONOTONIC, &ts); 
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9; 
+}
+
+// restarts the counters and clock for the next operation 
+void begin(void) {
+    AllocCount_reset(); 
+    startLive = AllocCount_get().liveBytes; 
+    startTime = now(); 
+}
+
+// live bytes are the net change over the operation, peak is relative to its start 
+void report(const char* name, int count) {
+    double ms = (now() - startTime) * 1e3; 
+    AllocCount counts = AllocCount_get(); 
+    printf("%-28s %9d %9ld %12.2f %12.2f %10.3f\n", name, count, counts.totalBlocks, 
+            (double)(counts.liveBytes - startLive) / count, (double)(counts.peakBytes - startLive) / count, ms);
+}
@@ -9,10 +9,22 @@
 #include <stdio.h>
 
 #include "linklist.h"
+#include "allocount.h"
+
+#define MODEL_SEQUENCES 200     // randomized operation sequences checked against the array model 
+#define MODEL_STEPS 500         // operations per sequence 
+
+int failures = 0; 
 
 List* buildList(int a, int b, int c);
+void printDiag(ListStatus status, const char* msg);
+void check(bool ok, const char* what);
+int checkModel(List* list, int* model, int length);
 
 int main(int argc, char* argv[]) {
+    List_set_diag(printDiag); // report failures of the logging methods 
+    List_set_allocator(AllocCount_malloc, AllocCount_free); // count every Node and List 
+
     // TEST: new_List, init_List, List_prepend, new_Node, and init_Node
   
     //****************************************************************************
@@ -260,6 +272,8 @@ int main(int argc, char* argv[]) {
     List_print(list12); 
     printf("\n");
 
+    List_append(list13, 4); // list13 was emptied when it was added to list12 
+    List_append(list13, 5); 
     printf("list13 before adding list11: ");
     List_print(list13); 
     printf("list11 before being added to list13: ");
@@ -335,12 +349,223 @@ int main(int argc, char* argv[]) {
     List_print(list17); 
     List_clear(list17); // clear list with one value 
     List_print(list17); 
+    check(list17->length == 0 && list17->head == NULL && list17->tail == NULL, "cleared list17 is empty");
+
+    long before = AllocCount_get().liveBlocks; 
+    List_append(list17, 1); 
+    List_append(list17, 2); 
+    List_clear(list17); 
+    check(AllocCount_get().liveBlocks == before, "List_clear frees every node");
     printf("\n"); 
 
     //**************************************************************************
 
 
 
+    //**************************************************************************
+    // TEST: List_try_get, List_try_insert, List_try_remove 
+    printf("Test try methods:\n");
+    //**************************************************************************
+    List_set_diag(NULL); // try methods never log, make sure nothing is printed 
+
+    List* list18 = new_List(); 
+    int out = -1; 
+    if (List_try_get(list18, 0, &out) == LIST_ERR_EMPTY && out == -1) {
+        printf("try_get on empty list reports LIST_ERR_EMPTY\n");
+    }
+    if (List_try_insert(list18, 1, 5) == LIST_ERR_INDEX && list18->length == 0) {
+        printf("try_insert past the end of empty list18 is rejected\n");
+    }
+    List_try_insert(list18, 0, 0);  // a stored 0 is distinguishable from an error 
+    List_try_insert(list18, 1, 20); 
+    List_try_insert(list18, 1, 10); 
+    printf("list18: ");
+    List_print(list18); 
+    if (List_try_get(list18, 0, &out) == LIST_OK && out == 0) {
+        printf("try_get at index 0 returns LIST_OK and value %d\n", out);
+    }
+    if (List_try_get(list18, 3, &out) == LIST_ERR_INDEX) {
+        printf("try_get at index 3 reports %s\n", List_strstatus(LIST_ERR_INDEX));
+    }
+    if (List_try_remove(list18, -1, &out) == LIST_ERR_INDEX && list18->length == 3) {
+        printf("try_remove at index -1 is rejected\n");
+    }
+    if (List_try_remove(list18, 2, &out) == LIST_OK && out == 20) {
+        printf("try_remove at index 2 returned %d\n", out);
+    }
+    List_try_remove(list18, 0, NULL); // discard the removed value 
+    printf("resulting list18: ");
+    List_print(list18); 
+
+    List_set_diag(printDiag); 
+    printf("\n");
+
+    //**************************************************************************
+
+
+
+    //**************************************************************************
+    // TEST: List_concat, List_split_at, List_splice 
+    printf("Test concat, split and splice:\n");
+    //**************************************************************************
+    List* list19 = buildList(1, 2, 3); 
+    List* list20 = buildList(4, 5, 6); 
+    List_concat(list19, list20); 
+    printf("list19 after concat: ");
+    List_print(list19); 
+    printf("list20 after concat: ");
+    List_print(list20); 
+    List_append(list19, 7); // tail must follow the moved nodes 
+    printf("list19 after append: ");
+    List_print(list19); 
+
+    if (List_split_at(list19, 8, list20) == LIST_ERR_INDEX) {
+        printf("split at index 8 of a list of length 7 is rejected\n");
+    }
+    List_split_at(list19, 4, list20); // move [ 5 6 7 ] into list20 
+    printf("list19 after split at 4: ");
+    List_print(list19); 
+    printf("list20 after split at 4: ");
+    List_print(list20); 
+    if (list19->length == 4 && list20->length == 3 && list19->tail->data == 4) {
+        printf("lengths and tail updated after split\n");
+    }
+
+    // move [ 2 3 ] from list19 to the front of list20 
+    Node* prev = list19->head; 
+    List_splice(list20, NULL, list19, prev, prev->next->next, 2); 
+    printf("list19 after splice: ");
+    List_print(list19); 
+    printf("list20 after splice: ");
+    List_print(list20); 
+
+    // move the whole of list20 after the first node of list19 
+    List_splice(list19, list19->head, list20, NULL, list20->tail, list20->length); 
+    List_append(list20, 8); 
+    printf("list19 after whole-list splice: ");
+    List_print(list19); 
+    printf("list20 reused after splice: ");
+    List_print(list20); 
+    printf("\n");
+
+    //**************************************************************************
+
+
+
+    //**************************************************************************
+    // TEST: allocation failure 
+    printf("Test allocation failure:\n");
+    //**************************************************************************
+    List_set_diag(NULL); 
+    List* list21 = buildList(1, 2, 3); 
+    before = AllocCount_get().liveBlocks; 
+    AllocCount_fail_after(0); // every allocation fails from here 
+    check(List_try_insert(list21, 1, 9) == LIST_ERR_NOMEM, "try_insert reports LIST_ERR_NOMEM");
+    check(List_try_insert(list21, 7, 9) == LIST_ERR_INDEX, "bad index is reported before allocating");
+    List_append(list21, 4); 
+    List_prepend(list21, 0); 
+    check(list21->length == 3 && list21->tail->data == 3, "failed append and prepend leave list21 unchanged");
+    check(AllocCount_get().liveBlocks == before, "failed operations allocate nothing");
+    AllocCount_reset(); 
+    List_set_diag(printDiag); 
+    printf("\n");
+
+    //**************************************************************************
+
+
+
+    //**************************************************************************
+    // TEST: randomized operations against a plain array 
+    printf("Test against array model:\n");
+    //**************************************************************************
+    List_set_diag(NULL); 
+    srand(230); 
+    long baseline = AllocCount_get().liveBlocks; 
+    int model[MODEL_STEPS]; 
+    int mismatches = 0; 
+    for (int seq = 0; seq < MODEL_SEQUENCES; seq++) {
+        List* list = new_List(); 
+        List* spare = new_List(); // receives split nodes, moved back by concat 
+        int length = 0; 
+        for (int step = 0; step < MODEL_STEPS; step++) {
+            int value = rand() % 100; 
+            int index = rand() % (length + 3) - 1; // includes -1, length and length + 1 
+            int out = -1; 
+            switch (rand() % 9) {
+                case 0: 
+                    List_append(list, value); 
+                    model[length++] = value; 
+                    break; 
+                case 1: 
+                    List_prepend(list, value); 
+                    for (int i = length; i > 0; i--) model[i] = model[i - 1]; 
+                    model[0] = value; 
+                    length++; 
+                    break; 
+                case 2: 
+                case 3: {
+                    ListStatus status = List_try_insert(list, index, value); 
+                    if (index >= 0 && index <= length) {
+                        mismatches += (status != LIST_OK); 
+                        for (int i = length; i > index; i--) model[i] = model[i - 1]; 
+                        model[index] = value; 
+                        length++; 
+                    } else {
+                        mismatches += (status != LIST_ERR_INDEX); 
+                    }
+                    break; 
+                }
+                case 4: 
+                case 5: {
+                    ListStatus status = List_try_remove(list, index, &out); 
+                    if (index >= 0 && index < length) {
+                        mismatches += (status != LIST_OK || out != model[index]); 
+                        for (int i = index; i < length - 1; i++) model[i] = model[i + 1]; 
+                        length--; 
+                    } else {
+                        mismatches += (status == LIST_OK); 
+                    }
+                    break; 
+                }
+                case 6: {
+                    ListStatus status = List_try_get(list, index, &out); 
+                    bool valid = index >= 0 && index < length; 
+                    mismatches += valid ? (status != LIST_OK || out != model[index]) : (status == LIST_OK); 
+                    bool inModel = false; 
+                    for (int i = 0; i < length; i++) inModel = inModel || model[i] == value; 
+                    mismatches += (List_contains(list, value) != inModel); 
+                    break; 
+                }
+                case 7: 
+                    if (List_split_at(list, (index < 0) ? 0 : index, spare) == LIST_OK) {
+                        mismatches += (list->length + spare->length != length); 
+                        List_concat(list, spare); // the model is unchanged by split and concat 
+                    }
+                    mismatches += (spare->length != 0 || spare->head != NULL); 
+                    break; 
+                case 8: 
+                    if (rand() % 20 == 0) { // clear rarely so lists grow long 
+                        List_clear(list); 
+                        length = 0; 
+                    }
+                    break; 
+            }
+            mismatches += checkModel(list, model, length); 
+            mismatches += (AllocCount_get().liveBlocks != baseline + 2 + length); // two lists plus one node per value 
+        }
+        delete_List(list); 
+        delete_List(spare); 
+        mismatches += (AllocCount_get().liveBlocks != baseline); // nothing left behind by the sequence 
+    }
+    check(mismatches == 0, "List matches the array model after every operation");
+    printf("%d sequences of %d operations, %d mismatches\n", MODEL_SEQUENCES, MODEL_STEPS, mismatches);
+    List_set_diag(printDiag); 
+    printf("\n");
+
+    //**************************************************************************
+
+
+
     //**************************************************************************
     // TEST: delete_List
     printf("Test delete:\n");
@@ -363,11 +588,22 @@ int main(int argc, char* argv[]) {
     delete_List(list15); 
     delete_List(list16); 
     delete_List(list17);  
-
+    delete_List(list18); 
+    delete_List(list19); 
+    delete_List(list20); 
+    delete_List(list21); 
+    delete_List(listA); 
+    delete_List(listB); 
+
+    check(AllocCount_get().liveBlocks == 0, "no nodes or lists are left allocated");
     printf("all lists (should have been) successfuly deleted\n\n"); 
 
     //**************************************************************************
 
+    if (failures > 0) {
+        printf("%d check(s) failed\n", failures);
+        return EXIT_FAILURE; 
+    }
     return EXIT_SUCCESS;
 }
 
@@ -379,6 +615,34 @@ List* buildList(int a, int b, int c) {
     return list;
 }
 
+void printDiag(ListStatus status, const char* msg) {
+    fprintf(stderr, "list error %d: %s\n", (int)status, msg);
+}
+
+void check(bool ok, const char* what) {
+    printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+    if (!ok) {
+        failures++; 
+    }
+}
+
+// returns 1 if list does not hold exactly the first length values of model 
+int checkModel(List* list, int* model, int length) {
+    if (list->length != length) {
+        return 1; 
+    }
+    Node* cursor = list->head; 
+    Node* last = NULL; 
+    for (int i = 0; i < length; i++) {
+        if (cursor == NULL || cursor->data != model[i]) {
+            return 1; 
+        }
+        last = cursor; 
+        cursor = cursor->next; 
+    }
+    return (cursor != NULL || list->tail != last) ? 1 : 0; 
+}
+
 /* CORRECT OUTPUT
 [ 1 2 3 ]
 [ 1 2 3 4 ]
@@ -0,0 +1,288 @@
+/**
+ * @file persistlist.c
+ * @author Joseph Allred
+ * @brief Method implementations for persistent (immutable) list module 
+ * @date 2026-10-19
+ */
+
+#include <stdatomic.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "persistlist.h"
+
+/**
+ * @brief Allocates a node holding a single reference, owned by the caller.
+ * 
+ * @param data   The value to be stored in this node
+ * @param length The length of the version starting at this node
+ * @param next   The node that follows, its reference is handed to this node
+ * @return PNode* to the new node, or NULL if allocation failed
+ */
+static PNode* new_PNode(int data, int length, PNode* next) {
+    PNode* node = (PNode*)malloc(sizeof(PNode));
+    if (node != NULL) {
+        node->data = data; 
+        node->length = length; 
+        node->next = next; 
+        atomic_init(&node->refs, 1); 
+    }
+    return node; 
+}
+
+/**
+ * @brief Takes a new reference on a version, e.g. to hand a snapshot to a reader.
+ * 
+ * This is O(1) regardless of length since only the first node is touched; the 
+ * rest of the version is kept alive through the references between nodes.
+ * 
+ * @param list The version to be retained, may be NULL
+ * @return     The same version, to be released with PList_release
+ */
+PNode* PList_retain(PNode* list) {
+    if (list != NULL) {
+        atomic_fetch_add(&list->refs, 1); 
+    }
+    return list; 
+}
+
+/**
+ * @brief Drops a reference on a version and frees every node no longer reachable.
+ * 
+ * Nodes are released front to back in a loop rather than recursively, so 
+ * dropping the last reference to a very long version cannot overflow the stack. 
+ * Reclamation stops at the first node still shared with another version.
+ * 
+ * @param list The version to be released, may be NULL
+ */
+void PList_release(PNode* list) {
+    while (list != NULL && atomic_fetch_sub(&list->refs, 1) == 1) {
+        PNode* next = list->next; 
+        free(list); 
+        list = next; // this node's reference on next is dropped along with it 
+    }
+}
+
+/**
+ * @brief Builds a new version with data in front of an existing one.
+ * 
+ * The existing version is shared, not copied, and stays valid for anyone else 
+ * holding it. The caller keeps its own reference on tail.
+ * 
+ * @param data The value to be placed first
+ * @param tail The version to follow it, may be NULL
+ * @return     The new version, or NULL if allocation failed
+ */
+PNode* PList_cons(int data, PNode* tail) {
+    PNode* node = new_PNode(data, PList_length(tail) + 1, tail); 
+    if (node != NULL) {
+        PList_retain(tail); // the new node holds its own reference on tail 
+    }
+    return node; 
+}
+
+/**
+ * @brief Prepends the given value, producing a new version in O(1).
+ * 
+ * @param list The version to be prepended to, left unchanged
+ * @param data The value to be prepended
+ * @return     The new version, or NULL if allocation failed
+ */
+PNode* PList_prepend(PNode* list, int data) {
+    return PList_cons(data, list); 
+}
+
+/**
+ * @brief Returns the version without its first value, in O(1).
+ * 
+ * @param list The version to be popped, left unchanged
+ * @param out  Receives the first value, untouched if list is empty, may be NULL
+ * @return     A new reference on the rest of the list, NULL when it is empty
+ */
+PNode* PList_pop(PNode* list, int* out) {
+    if (list == NULL) {
+        return NULL; 
+    }
+    if (out != NULL) {
+        *out = list->data; 
+    }
+    return PList_retain(list->next); 
+}
+
+/**
+ * @brief Builds a new version without the value at the given index.
+ * 
+ * The nodes in front of index are copied and everything after it is shared, so 
+ * the cost is O(index) time and memory. An out-of-bounds index yields a new 
+ * reference on the unchanged version.
+ * 
+ * @param list  The version to be removed from, left unchanged
+ * @param index The index of the value to be left out
+ * @return      The new version; NULL is also returned if allocation failed
+ */
+PNode* PList_remove(PNode* list, int index) {
+
+    if (index < 0 || index >= PList_length(list)) {
+        return PList_retain(list); 
+    }
+    PNode* head = NULL; 
+    PNode** link = &head; // where the next copied node gets attached 
+    PNode* cursor = list; 
+    for (int i = 0; i < index; i++) {
+        PNode* copy = new_PNode(cursor->data, cursor->length - 1, NULL); 
+        if (copy == NULL) {
+            PList_release(head); // drop the partial copy 
+            return NULL; 
+        }
+        *link = copy; 
+        link = &copy->next; 
+        cursor = cursor->next; 
+    }
+    *link = PList_retain(cursor->next); // share everything after the removed node 
+    return head; 
+}
+
+/**
+ * @brief Builds a version holding the same values as a mutable List.
+ * 
+ * @param list The list to be copied, left unchanged
+ * @return     The new version, NULL if list is empty or allocation failed
+ */
+PNode* PList_from_List(List* list) {
+
+    PNode* head = NULL; 
+    PNode** link = &head; 
+    int remaining = list->length; 
+    for (Node* cursor = list->head; cursor != NULL; cursor = cursor->next) {
+        PNode* copy = new_PNode(cursor->data, remaining, NULL); 
+        if (copy == NULL) {
+            PList_release(head); 
+            return NULL; 
+        }
+        *link = copy; 
+        link = &copy->next; 
+        remaining -= 1; 
+    }
+    return head; 
+}
+
+/**
+ * @brief Returns the number of values in a version in O(1).
+ * 
+ * @param list The version to be measured, may be NULL
+ * @return     The length of the version
+ */
+int PList_length(PNode* list) {
+    return (list == NULL) ? 0 : list->length; 
+}
+
+/**
+ * @brief Retrieves the value at the given index of a version.
+ * 
+ * @param list  The version to be indexed
+ * @param index The index of the value to be retrieved
+ * @param out   Receives the value, untouched on failure
+ * @return      LIST_OK, LIST_ERR_EMPTY or LIST_ERR_INDEX
+ */
+ListStatus PList_try_get(PNode* list, int index, int* out) {
+
+    if (list == NULL) {
+        return LIST_ERR_EMPTY; 
+    }
+    if (index < 0 || index >= list->length) {
+        return LIST_ERR_INDEX; 
+    }
+    for (int i = 0; i < index; i++) {
+        list = list->next; 
+    }
+    *out = list->data; 
+    return LIST_OK; 
+}
+
+/**
+ * @brief Checks whether or not the given version contains the given value
+ * 
+ * @param list   The version to be checked for the item
+ * @param value  The value for which the version should be searched
+ * @return true  If the version contains the item
+ * @return false If the version does not contain the item
+ */
+bool PList_contains(PNode* list, int value) {
+    for (PNode* cursor = list; cursor != NULL; cursor = cursor->next) {
+        if (cursor->data == value) {
+            return true; 
+        }
+    }
+    return false; 
+}
+
+/**
+ * @brief Prints out an entire version
+ * 
+ * @param list the version to be printed
+ */
+void PList_print(PNode* list) {
+    printf("[ ");
+    for (PNode* cursor = list; cursor != NULL; cursor = cursor->next) {
+        printf("%d ", cursor->data);
+    }
+    printf("]\n");
+}
+
+/**
+ * @brief Initialize a root that already exists in memory, publishing the empty list.
+ * 
+ * @param root the root to be initialized
+ */
+void init_PListRoot(PListRoot* root) {
+    pthread_mutex_init(&root->lock, NULL); 
+    root->current = NULL; 
+}
+
+/**
+ * @brief Releases the published version and the root's lock.
+ * 
+ * No thread may use the root once this has been called. Snapshots taken from 
+ * it stay valid until their owners release them.
+ * 
+ * @param root the root to be destroyed
+ */
+void destroy_PListRoot(PListRoot* root) {
+    PList_release(root->current); 
+    root->current = NULL; 
+    pthread_mutex_destroy(&root->lock); 
+}
+
+/**
+ * @brief Makes a version the one handed to future snapshots.
+ * 
+ * The root takes its own reference on version, so the caller keeps theirs. The 
+ * previously published version is released after the lock is dropped, so a 
+ * long reclamation never blocks readers.
+ * 
+ * @param root    The root to publish to
+ * @param version The version to be published, may be NULL
+ */
+void PListRoot_publish(PListRoot* root, PNode* version) {
+    PList_retain(version); 
+    pthread_mutex_lock(&root->lock); 
+    PNode* old = root->current; 
+    root->current = version; 
+    pthread_mutex_unlock(&root->lock); 
+    PList_release(old); 
+}
+
+/**
+ * @brief Takes a reference on the currently published version.
+ * 
+ * @param root The root to snapshot
+ * @return     The current version, to be released with PList_release
+ */
+PNode* PListRoot_snapshot(PListRoot* root) {
+    pthread_mutex_lock(&root->lock); 
+    PNode* version = PList_retain(root->current); // cannot be freed while the lock is held 
+    pthread_mutex_unlock(&root->lock); 
+    return version; 
+}
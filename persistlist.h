@@ -0,0 +1,68 @@
+/**
+ * @file persistlist.h
+ * @author Joseph Allred 
+ * @brief Struct and method declarations for persistent (immutable) list module 
+ * @date 2026-10-19
+ */
+
+#ifndef COMP230_PERSISTLIST_H
+#define COMP230_PERSISTLIST_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "linklist.h"
+
+/* definition for PNode 
+ *
+ * A version of a persistent list is a pointer to its first PNode, NULL being 
+ * the empty list. Nodes are never modified once published, so every version 
+ * shares its tail with the versions it was built from. Each node counts the 
+ * references held on it by callers and by the nodes in front of it. */
+typedef struct PNode {
+    int data; 
+    int length;             // number of nodes in the version starting here 
+    atomic_int refs;        // live references, the node is freed at zero 
+    struct PNode* next; 
+} PNode; 
+
+/* definition for PListRoot 
+ *
+ * Holds the current version for a writer to publish and readers to snapshot. 
+ * Retaining a version needs a reference the caller already owns: calling 
+ * PList_retain on a shared pointer races with the writer releasing it. The 
+ * root closes that gap by retaining under a short lock, after which a reader 
+ * traverses its snapshot without any locking. */
+typedef struct PListRoot {
+    pthread_mutex_t lock; 
+    PNode* current;         // the root's own reference on the published version 
+} PListRoot; 
+
+// PListRoot constructor methods 
+void init_PListRoot(PListRoot* root);
+void destroy_PListRoot(PListRoot* root);
+
+// publish and snapshot, safe from any thread 
+void PListRoot_publish(PListRoot* root, PNode* version);
+PNode* PListRoot_snapshot(PListRoot* root);
+
+// reference management, every returned version is owned by the caller 
+PNode* PList_retain(PNode* list);
+void PList_release(PNode* list);
+
+// methods that build new versions, the version passed in is left unchanged 
+PNode* PList_cons(int data, PNode* tail);
+PNode* PList_prepend(PNode* list, int data);
+PNode* PList_pop(PNode* list, int* out);
+PNode* PList_remove(PNode* list, int index);
+PNode* PList_from_List(List* list);
+
+// read-only methods, safe on any version the caller holds a reference to 
+int PList_length(PNode* list);
+ListStatus PList_try_get(PNode* list, int index, int* out);
+bool PList_contains(PNode* list, int value);
+void PList_print(PNode* list);
+
+#endif /* COMP230_PERSISTLIST_H */
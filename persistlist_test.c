@@ -0,0 +1,249 @@
+/**
+ * @file persistlist_test.c
+ * @author Joseph Allred 
+ * @brief tests for all methods implemented in persistlist.c 
+ * @date 2026-10-19 
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+
+#include "persistlist.h"
+
+#define WRITER_STEPS 20000
+#define READER_COUNT 4
+
+// state shared between the writer and reader threads 
+typedef struct ReaderArgs {
+    PListRoot* root; 
+    atomic_bool* done; 
+    long snapshots; 
+    long broken;            // snapshots whose lengths did not add up 
+} ReaderArgs; 
+
+void* snapshotReader(void* arg);
+
+int main(int argc, char* argv[]) {
+
+    //**************************************************************************
+    // TEST: PList_prepend, PList_cons, PList_length
+    printf("Test prepend:\n");
+    //**************************************************************************
+
+    PNode* v0 = NULL; // the empty list 
+    PNode* v1 = PList_prepend(v0, 3); 
+    PNode* v2 = PList_prepend(v1, 2); 
+    PNode* v3 = PList_cons(1, v2); 
+    printf("v1: ");
+    PList_print(v1); 
+    printf("v2: ");
+    PList_print(v2); 
+    printf("v3: ");
+    PList_print(v3); 
+    if (v3->next == v2 && v2->next == v1) {
+        printf("v3 shares its tail with v2 and v1\n");
+    }
+    if (PList_length(v0) == 0 && PList_length(v3) == 3) {
+        printf("lengths of v0 and v3 are %d and %d\n", PList_length(v0), PList_length(v3));
+    }
+    printf("\n");
+
+    //**************************************************************************
+
+
+
+    //**************************************************************************
+    // TEST: PList_pop, PList_retain, PList_release
+    printf("Test pop and snapshots:\n");
+    //**************************************************************************
+
+    PNode* snapshot = PList_retain(v3); // O(1) snapshot for a reader 
+    int out = -1; 
+    PNode* v4 = PList_pop(v3, &out); 
+    printf("popped %d, v4: ", out);
+    PList_print(v4); 
+    if (v4 == v2) {
+        printf("pop returns the shared tail without copying\n");
+    }
+    PList_release(v3); // writer moves on, the snapshot keeps v3 alive 
+    printf("snapshot after writer released v3: ");
+    PList_print(snapshot); 
+
+    out = -1; 
+    if (PList_pop(v0, &out) == NULL && out == -1) {
+        printf("pop on empty list returns NULL\n");
+    }
+    printf("\n");
+
+    //**************************************************************************
+
+
+
+    //**************************************************************************
+    // TEST: PList_remove, PList_try_get, PList_contains
+    printf("Test remove and get:\n");
+    //**************************************************************************
+
+    PNode* v5 = PList_prepend(snapshot, 0); // [ 0 1 2 3 ] 
+    PNode* v6 = PList_remove(v5, 2);         // [ 0 1 3 ] 
+    printf("v5: ");
+    PList_print(v5); 
+    printf("v6 (v5 without index 2): ");
+    PList_print(v6); 
+    if (v6->next->next == v1) {
+        printf("v6 shares the nodes after the removed one\n");
+    }
+    PNode* v7 = PList_remove(v5, 4); 
+    if (v7 == v5) {
+        printf("remove at index 4 returns the unchanged version\n");
+    }
+    PList_release(v7); 
+
+    if (PList_try_get(v6, 2, &out) == LIST_OK) {
+        printf("The value of v6 at index 2 is %d\n", out);
+    }
+    if (PList_try_get(v6, 3, &out) == LIST_ERR_INDEX && PList_try_get(v0, 0, &out) == LIST_ERR_EMPTY) {
+        printf("try_get reports out-of-bounds and empty versions\n");
+    }
+    if (PList_contains(v5, 2) && !PList_contains(v6, 2)) {
+        printf("v5 contains 2, v6 does not\n");
+    }
+    printf("\n");
+
+    //**************************************************************************
+
+
+
+    //**************************************************************************
+    // TEST: PList_from_List
+    printf("Test from List:\n");
+    //**************************************************************************
+
+    List* list1 = new_List(); 
+    List_append(list1, 7); 
+    List_append(list1, 8); 
+    List_append(list1, 9); 
+    PNode* v8 = PList_from_List(list1); 
+    List_clear(list1); // the version does not depend on the list 
+    printf("v8: ");
+    PList_print(v8); 
+    if (PList_length(v8) == 3 && PList_length(v8->next) == 2) {
+        printf("lengths of copied nodes are correct\n");
+    }
+    delete_List(list1); 
+    printf("\n");
+
+    //**************************************************************************
+
+
+
+    //**************************************************************************
+    // TEST: reclamation of long versions 
+    printf("Test release:\n");
+    //**************************************************************************
+
+    PNode* big = NULL; 
+    for (int i = 0; i < 1000000; i++) {
+        PNode* next = PList_prepend(big, i); 
+        PList_release(big); 
+        big = next; 
+    }
+    PNode* bigSnapshot = PList_retain(big); 
+    PNode* bigPopped = PList_pop(big, NULL); 
+    PList_release(big); 
+    printf("long version has %d nodes after pop\n", PList_length(bigPopped));
+    PList_release(bigSnapshot); 
+    PList_release(bigPopped); // last reference, frees a million nodes without recursing 
+    printf("\n");
+
+    //**************************************************************************
+
+
+
+    //**************************************************************************
+    // TEST: PListRoot with a writer and concurrent snapshot readers 
+    printf("Test concurrent snapshots:\n");
+    //**************************************************************************
+
+    PListRoot root; 
+    init_PListRoot(&root); 
+    atomic_bool done; 
+    atomic_init(&done, false); 
+    ReaderArgs readers[READER_COUNT]; 
+    pthread_t threads[READER_COUNT]; 
+    for (int i = 0; i < READER_COUNT; i++) {
+        readers[i] = (ReaderArgs){ &root, &done, 0, 0 }; 
+        pthread_create(&threads[i], NULL, snapshotReader, &readers[i]); 
+    }
+    PNode* current = NULL; 
+    for (int i = 0; i < WRITER_STEPS; i++) {
+        PNode* next = NULL; 
+        if (i % 5 == 4) {
+            next = PList_pop(current, NULL); 
+        } else if (i % 7 == 6) {
+            next = PList_remove(current, PList_length(current) / 2); 
+        } else {
+            next = PList_prepend(current, i); 
+        }
+        PListRoot_publish(&root, next); 
+        PList_release(current); // readers may still hold it through a snapshot 
+        current = next; 
+    }
+    atomic_store(&done, true); 
+    long snapshots = 0; 
+    long broken = 0; 
+    for (int i = 0; i < READER_COUNT; i++) {
+        pthread_join(threads[i], NULL); 
+        snapshots += readers[i].snapshots; 
+        broken += readers[i].broken; 
+    }
+    if (snapshots > 0 && broken == 0) {
+        printf("%d readers traversed their snapshots consistently\n", READER_COUNT);
+    }
+    PList_release(current); 
+    destroy_PListRoot(&root); 
+    printf("\n");
+
+    //**************************************************************************
+
+
+
+    //**************************************************************************
+    // TEST: PList_release of the remaining versions 
+    printf("Test release all:\n");
+    //**************************************************************************
+
+    PList_release(v1); 
+    PList_release(v2); 
+    PList_release(v4); 
+    PList_release(snapshot); 
+    PList_release(v5); 
+    PList_release(v6); 
+    PList_release(v8); 
+
+    printf("all versions (should have been) successfuly released\n\n"); 
+
+    //**************************************************************************
+
+    return EXIT_SUCCESS;
+}
+
+void* snapshotReader(void* arg) {
+    ReaderArgs* reader = (ReaderArgs*)arg; 
+    do {
+        PNode* snapshot = PListRoot_snapshot(reader->root); 
+        int expect = PList_length(snapshot); // each node is one shorter than the one before 
+        PNode* cursor = snapshot; 
+        while (cursor != NULL && cursor->length == expect) {
+            cursor = cursor->next; 
+            expect--; 
+        }
+        if (cursor != NULL || expect != 0) {
+            reader->broken++; 
+        }
+        PList_release(snapshot); 
+        reader->snapshots++; 
+    } while (!atomic_load(reader->done)); 
+    return NULL; 
+}
@@ -0,0 +1,343 @@
+/**
+ * @file queue.c
+ * @author Joseph Allred
+ * @brief Method implementations for bounded FIFO queue module 
+ * @date 2026-10-19
+ */
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "queue.h"
+
+/**
+ * @brief Allocates memory and creates a new empty single-producer queue.
+ * 
+ * The capacity is rounded up to a whole number of chunks and every chunk is 
+ * allocated here, so later pushes and pops never touch the allocator. Queues 
+ * constructed using this function should be cleaned up using delete_Queue.
+ * 
+ * @param capacity The minimum number of values the queue must hold
+ * @return Queue* to the new queue, or NULL if capacity is not positive or 
+ *         allocation failed
+ */
+Queue* new_Queue(int capacity) {
+
+    if (capacity <= 0) {
+        return NULL; 
+    }
+    Queue* queue = (Queue*)aligned_alloc(QUEUE_CACHE_LINE, sizeof(Queue)); 
+    if (queue == NULL) {
+        return NULL; 
+    }
+    size_t numChunks = ((size_t)capacity + QUEUE_CHUNK_SIZE - 1) / QUEUE_CHUNK_SIZE; 
+    queue->chunks = NULL; 
+    QueueChunk* last = NULL; 
+    for (size_t i = 0; i < numChunks; i++) {
+        QueueChunk* chunk = (QueueChunk*)malloc(sizeof(QueueChunk)); 
+        if (chunk == NULL) {
+            if (last != NULL) {
+                last->next = queue->chunks; // close the ring so delete_Queue can walk it 
+            }
+            delete_Queue(queue); 
+            return NULL; 
+        }
+        chunk->next = queue->chunks; 
+        if (last == NULL) {
+            last = chunk; 
+        }
+        queue->chunks = chunk; 
+    }
+    last->next = queue->chunks; // link the last chunk back to the first 
+
+    queue->capacity = numChunks * QUEUE_CHUNK_SIZE; 
+    atomic_init(&queue->popped, 0); 
+    atomic_init(&queue->pushed, 0); 
+    queue->headChunk = queue->chunks; 
+    queue->tailChunk = queue->chunks; 
+    queue->headIdx = 0; 
+    queue->tailIdx = 0; 
+    queue->pushedCache = 0; 
+    queue->poppedCache = 0; 
+    return queue; 
+}
+
+/**
+ * @brief Deletes a queue, freeing every chunk and the queue itself.
+ * 
+ * @param queue The queue to be deleted
+ */
+void delete_Queue(Queue* queue) {
+
+    QueueChunk* chunk = queue->chunks; 
+    while (chunk != NULL) {
+        QueueChunk* next = chunk->next; 
+        free(chunk); 
+        chunk = (next == queue->chunks) ? NULL : next; // stop once the ring wraps 
+    }
+    free(queue); 
+}
+
+/**
+ * @brief Adds a value at the tail of the queue. Producer thread only.
+ * 
+ * @param queue The queue to be pushed to
+ * @param value The value to be pushed
+ * @return      LIST_OK or LIST_ERR_FULL
+ */
+ListStatus Queue_push(Queue* queue, int value) {
+
+    size_t pushed = atomic_load_explicit(&queue->pushed, memory_order_relaxed); 
+    if (pushed - queue->poppedCache == queue->capacity) {
+        // only look at the consumer's counter when the cached one says full 
+        queue->poppedCache = atomic_load_explicit(&queue->popped, memory_order_acquire); 
+        if (pushed - queue->poppedCache == queue->capacity) {
+            return LIST_ERR_FULL; 
+        }
+    }
+    queue->tailChunk->data[queue->tailIdx] = value; 
+    queue->tailIdx += 1; 
+    if (queue->tailIdx == QUEUE_CHUNK_SIZE) {
+        queue->tailChunk = queue->tailChunk->next; 
+        queue->tailIdx = 0; 
+    }
+    atomic_store_explicit(&queue->pushed, pushed + 1, memory_order_release); // publish the value 
+    return LIST_OK; 
+}
+
+/**
+ * @brief Removes up to max values from the head of the queue. Consumer thread only.
+ * 
+ * Values are copied a chunk run at a time and the popped counter is published 
+ * once for the whole batch.
+ * 
+ * @param queue The queue to be popped from
+ * @param out   Receives the values in FIFO order, room for at least max values
+ * @param max   The largest number of values to be removed
+ * @return      The number of values removed, 0 if the queue is empty
+ */
+int Queue_pop_batch(Queue* queue, int* out, int max) {
+
+    if (max <= 0) {
+        return 0; 
+    }
+    size_t popped = atomic_load_explicit(&queue->popped, memory_order_relaxed); 
+    size_t available = queue->pushedCache - popped; 
+    if (available < (size_t)max) {
+        queue->pushedCache = atomic_load_explicit(&queue->pushed, memory_order_acquire); 
+        available = queue->pushedCache - popped; 
+    }
+    int count = (available < (size_t)max) ? (int)available : max; 
+    int done = 0; 
+    while (done < count) {
+        int run = QUEUE_CHUNK_SIZE - queue->headIdx; // values left in this chunk 
+        if (run > count - done) {
+            run = count - done; 
+        }
+        memcpy(out + done, queue->headChunk->data + queue->headIdx, (size_t)run * sizeof(int)); 
+        done += run; 
+        queue->headIdx += run; 
+        if (queue->headIdx == QUEUE_CHUNK_SIZE) {
+            queue->headChunk = queue->headChunk->next; 
+            queue->headIdx = 0; 
+        }
+    }
+    if (count > 0) {
+        atomic_store_explicit(&queue->popped, popped + (size_t)count, memory_order_release); // hand slots back 
+    }
+    return count; 
+}
+
+/**
+ * @brief Removes the value at the head of the queue. Consumer thread only.
+ * 
+ * @param queue The queue to be popped from
+ * @param out   Receives the value, untouched if the queue is empty
+ * @return      LIST_OK or LIST_ERR_EMPTY
+ */
+ListStatus Queue_pop(Queue* queue, int* out) {
+    return (Queue_pop_batch(queue, out, 1) == 1) ? LIST_OK : LIST_ERR_EMPTY; 
+}
+
+/**
+ * @brief Returns the number of values in the queue.
+ * 
+ * The result is exact when called by the producer or consumer while the other 
+ * side is idle, and a snapshot otherwise.
+ * 
+ * @param queue The queue to be measured
+ * @return      The number of values waiting to be popped
+ */
+int Queue_length(Queue* queue) {
+    size_t popped = atomic_load(&queue->popped); 
+    size_t pushed = atomic_load(&queue->pushed); 
+    return (int)(pushed - popped); 
+}
+
+/**
+ * @brief Finds the slot used for a position in the multi-producer queue.
+ * 
+ * @param queue The queue the position belongs to
+ * @param pos   A push or pop position, which only ever increases
+ * @return      The slot for that position
+ */
+static MPMCSlot* MPMCQueue_slot(MPMCQueue* queue, size_t pos) {
+    size_t idx = pos % queue->capacity; 
+    return &queue->chunks[idx / QUEUE_CHUNK_SIZE]->slots[idx % QUEUE_CHUNK_SIZE]; 
+}
+
+/**
+ * @brief Allocates memory and creates a new empty multi-producer queue.
+ * 
+ * As with new_Queue, the capacity is rounded up to a whole number of chunks 
+ * which are all allocated here. Queues constructed using this function should 
+ * be cleaned up using delete_MPMCQueue.
+ * 
+ * @param capacity The minimum number of values the queue must hold
+ * @return MPMCQueue* to the new queue, or NULL if capacity is not positive or 
+ *         allocation failed
+ */
+MPMCQueue* new_MPMCQueue(int capacity) {
+
+    if (capacity <= 0) {
+        return NULL; 
+    }
+    MPMCQueue* queue = (MPMCQueue*)aligned_alloc(QUEUE_CACHE_LINE, sizeof(MPMCQueue)); 
+    if (queue == NULL) {
+        return NULL; 
+    }
+    queue->numChunks = ((size_t)capacity + QUEUE_CHUNK_SIZE - 1) / QUEUE_CHUNK_SIZE; 
+    queue->capacity = queue->numChunks * QUEUE_CHUNK_SIZE; 
+    queue->chunks = (MPMCChunk**)calloc(queue->numChunks, sizeof(MPMCChunk*)); 
+    if (queue->chunks == NULL) {
+        free(queue); 
+        return NULL; 
+    }
+    for (size_t i = 0; i < queue->numChunks; i++) {
+        queue->chunks[i] = (MPMCChunk*)malloc(sizeof(MPMCChunk)); 
+        if (queue->chunks[i] == NULL) {
+            delete_MPMCQueue(queue); // unallocated entries are still NULL 
+            return NULL; 
+        }
+        for (size_t j = 0; j < QUEUE_CHUNK_SIZE; j++) {
+            atomic_init(&queue->chunks[i]->slots[j].seq, i * QUEUE_CHUNK_SIZE + j); // ready for its first push 
+        }
+    }
+    atomic_init(&queue->pushPos, 0); 
+    atomic_init(&queue->popPos, 0); 
+    return queue; 
+}
+
+/**
+ * @brief Deletes a multi-producer queue, freeing every chunk and the queue itself.
+ * 
+ * @param queue The queue to be deleted
+ */
+void delete_MPMCQueue(MPMCQueue* queue) {
+    for (size_t i = 0; i < queue->numChunks; i++) {
+        free(queue->chunks[i]); 
+    }
+    free(queue->chunks); 
+    free(queue); 
+}
+
+/**
+ * @brief Adds a value at the tail of the queue. Safe from any thread.
+ * 
+ * A slot may be pushed to when its sequence equals the position being claimed; 
+ * after writing, the sequence is advanced by one to hand the slot to a consumer.
+ * 
+ * @param queue The queue to be pushed to
+ * @param value The value to be pushed
+ * @return      LIST_OK or LIST_ERR_FULL
+ */
+ListStatus MPMCQueue_push(MPMCQueue* queue, int value) {
+
+    size_t pos = atomic_load_explicit(&queue->pushPos, memory_order_relaxed); 
+    while (true) {
+        MPMCSlot* slot = MPMCQueue_slot(queue, pos); 
+        size_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire); 
+        ptrdiff_t diff = (ptrdiff_t)seq - (ptrdiff_t)pos; 
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&queue->pushPos, &pos, pos + 1, 
+                    memory_order_relaxed, memory_order_relaxed)) {
+                slot->data = value; 
+                atomic_store_explicit(&slot->seq, pos + 1, memory_order_release); 
+                return LIST_OK; 
+            }
+            // pos was reloaded by the failed exchange 
+        } else if (diff < 0) {
+            return LIST_ERR_FULL; // slot still holds a value from the previous lap 
+        } else {
+            pos = atomic_load_explicit(&queue->pushPos, memory_order_relaxed); // another producer got here first 
+        }
+    }
+}
+
+/**
+ * @brief Removes the value at the head of the queue. Safe from any thread.
+ * 
+ * A slot may be popped when its sequence is one past the position being 
+ * claimed; after reading, the sequence is advanced by the capacity so the slot 
+ * is ready for the push one lap later.
+ * 
+ * @param queue The queue to be popped from
+ * @param out   Receives the value, untouched if the queue is empty
+ * @return      LIST_OK or LIST_ERR_EMPTY
+ */
+ListStatus MPMCQueue_pop(MPMCQueue* queue, int* out) {
+
+    size_t pos = atomic_load_explicit(&queue->popPos, memory_order_relaxed); 
+    while (true) {
+        MPMCSlot* slot = MPMCQueue_slot(queue, pos); 
+        size_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire); 
+        ptrdiff_t diff = (ptrdiff_t)seq - (ptrdiff_t)(pos + 1); 
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&queue->popPos, &pos, pos + 1, 
+                    memory_order_relaxed, memory_order_relaxed)) {
+                *out = slot->data; 
+                atomic_store_explicit(&slot->seq, pos + queue->capacity, memory_order_release); 
+                return LIST_OK; 
+            }
+        } else if (diff < 0) {
+            return LIST_ERR_EMPTY; // nothing has been pushed to this slot yet 
+        } else {
+            pos = atomic_load_explicit(&queue->popPos, memory_order_relaxed); 
+        }
+    }
+}
+
+/**
+ * @brief Removes up to max values from the head of the queue. Safe from any thread.
+ * 
+ * Values are claimed one at a time, so with several consumers a batch is not 
+ * necessarily a contiguous run of the queue.
+ * 
+ * @param queue The queue to be popped from
+ * @param out   Receives the values, room for at least max values
+ * @param max   The largest number of values to be removed
+ * @return      The number of values removed, 0 if the queue is empty
+ */
+int MPMCQueue_pop_batch(MPMCQueue* queue, int* out, int max) {
+    int count = 0; 
+    while (count < max && MPMCQueue_pop(queue, out + count) == LIST_OK) {
+        count += 1; 
+    }
+    return count; 
+}
+
+/**
+ * @brief Returns the number of values in the queue.
+ * 
+ * Under concurrent use this is only a snapshot and may briefly count values 
+ * that are still being written or read.
+ * 
+ * @param queue The queue to be measured
+ * @return      The number of values waiting to be popped
+ */
+int MPMCQueue_length(MPMCQueue* queue) {
+    size_t popPos = atomic_load(&queue->popPos); 
+    size_t pushPos = atomic_load(&queue->pushPos); 
+    return (pushPos > popPos) ? (int)(pushPos - popPos) : 0; 
+}
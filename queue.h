@@ -0,0 +1,95 @@
+/**
+ * @file queue.h
+ * @author Joseph Allred 
+ * @brief Struct and method declarations for bounded FIFO queue module 
+ * @date 2026-10-19
+ */
+
+#ifndef COMP230_QUEUE_H
+#define COMP230_QUEUE_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdatomic.h>
+#include <stddef.h>
+
+#include "linklist.h"
+
+// number of values stored in each chunk, capacities are rounded up to a multiple 
+#define QUEUE_CHUNK_SIZE 256
+
+// keeps the producer and consumer counters on separate cache lines 
+#define QUEUE_CACHE_LINE 64
+
+// definition for QueueChunk, a fixed block of values linked into a ring 
+typedef struct QueueChunk {
+    int data[QUEUE_CHUNK_SIZE]; 
+    struct QueueChunk* next; 
+} QueueChunk; 
+
+/* definition for Queue, single-producer/single-consumer 
+ *
+ * All chunks are allocated up front and linked into a ring, so push and pop 
+ * never allocate. The producer owns the tail cursor and the consumer owns the 
+ * head cursor; they only share the pushed and popped counters. */
+typedef struct Queue {
+    size_t capacity; 
+    QueueChunk* chunks;                             // first chunk of the ring 
+
+    // consumer side 
+    _Alignas(QUEUE_CACHE_LINE) atomic_size_t popped; 
+    QueueChunk* headChunk; 
+    int headIdx; 
+    size_t pushedCache;                             // last value seen of pushed 
+
+    // producer side 
+    _Alignas(QUEUE_CACHE_LINE) atomic_size_t pushed; 
+    QueueChunk* tailChunk; 
+    int tailIdx; 
+    size_t poppedCache;                             // last value seen of popped 
+} Queue; 
+
+// definition for MPMCSlot, a value tagged with the turn it belongs to 
+typedef struct MPMCSlot {
+    atomic_size_t seq; 
+    int data; 
+} MPMCSlot; 
+
+// definition for MPMCChunk, a fixed block of slots 
+typedef struct MPMCChunk {
+    MPMCSlot slots[QUEUE_CHUNK_SIZE]; 
+} MPMCChunk; 
+
+/* definition for MPMCQueue, multi-producer/multi-consumer 
+ *
+ * Producers and consumers claim positions with compare-and-swap and hand off 
+ * each slot through its sequence number, so no locks are taken. */
+typedef struct MPMCQueue {
+    size_t capacity; 
+    size_t numChunks; 
+    MPMCChunk** chunks;                             // chunk table for O(1) slot lookup 
+    _Alignas(QUEUE_CACHE_LINE) atomic_size_t pushPos; 
+    _Alignas(QUEUE_CACHE_LINE) atomic_size_t popPos; 
+} MPMCQueue; 
+
+// Queue constructor methods 
+Queue* new_Queue(int capacity);
+void delete_Queue(Queue* queue);
+
+// methods supported by single-producer/single-consumer queue 
+ListStatus Queue_push(Queue* queue, int value);
+ListStatus Queue_pop(Queue* queue, int* out);
+int Queue_pop_batch(Queue* queue, int* out, int max);
+int Queue_length(Queue* queue);
+
+// MPMCQueue constructor methods 
+MPMCQueue* new_MPMCQueue(int capacity);
+void delete_MPMCQueue(MPMCQueue* queue);
+
+// methods supported by multi-producer/multi-consumer queue 
+ListStatus MPMCQueue_push(MPMCQueue* queue, int value);
+ListStatus MPMCQueue_pop(MPMCQueue* queue, int* out);
+int MPMCQueue_pop_batch(MPMCQueue* queue, int* out, int max);
+int MPMCQueue_length(MPMCQueue* queue);
+
+#endif /* COMP230_QUEUE_H */
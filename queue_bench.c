@@ -0,0 +1,162 @@
+/**
+ * @file queue_bench.c
+ * @author Joseph Allred 
+ * @brief throughput of queue.c against a List used as a FIFO 
+ * @date 2026-10-19 
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "queue.h"
+
+#define BENCH_COUNT 10000000
+#define BENCH_DEPTH 1024        // values kept in flight by the single-threaded runs 
+#define BENCH_BATCH 256
+
+double now(void);
+void report(const char* name, double seconds);
+void* spscProducer(void* arg);
+void* mpmcProducer(void* arg);
+void* mpmcConsumer(void* arg);
+
+int main(int argc, char* argv[]) {
+
+    long long sink = 0; // keeps popped values observable 
+
+    // List: append at tail, remove at head, one malloc/free per value 
+    List* list = new_List(); 
+    double start = now(); 
+    for (int i = 0; i < BENCH_DEPTH; i++) {
+        List_append(list, i); 
+    }
+    for (int i = BENCH_DEPTH; i < BENCH_COUNT; i++) {
+        List_append(list, i); 
+        sink += List_remove(list, 0); 
+    }
+    report("List append/remove(0)", now() - start); 
+    delete_List(list); 
+
+    // Queue: same pattern, one value at a time 
+    Queue* queue = new_Queue(BENCH_DEPTH + 1); 
+    int value = 0; 
+    start = now(); 
+    for (int i = 0; i < BENCH_DEPTH; i++) {
+        Queue_push(queue, i); 
+    }
+    for (int i = BENCH_DEPTH; i < BENCH_COUNT; i++) {
+        Queue_push(queue, i); 
+        Queue_pop(queue, &value); 
+        sink += value; 
+    }
+    report("Queue push/pop", now() - start); 
+    delete_Queue(queue); 
+
+    // Queue: pushes drained with batch pops 
+    queue = new_Queue(BENCH_DEPTH); 
+    int batch[BENCH_BATCH]; 
+    start = now(); 
+    for (int i = 0; i < BENCH_COUNT; ) {
+        while (i < BENCH_COUNT && Queue_push(queue, i) == LIST_OK) {
+            i++; 
+        }
+        int got = 0; 
+        while ((got = Queue_pop_batch(queue, batch, BENCH_BATCH)) > 0) {
+            sink += batch[got - 1]; 
+        }
+    }
+    report("Queue push/pop_batch", now() - start); 
+    delete_Queue(queue); 
+
+    // Queue: producer and consumer threads 
+    queue = new_Queue(BENCH_DEPTH * 16); 
+    pthread_t threads[4]; 
+    start = now(); 
+    pthread_create(&threads[0], NULL, spscProducer, queue); 
+    for (int popped = 0; popped < BENCH_COUNT; ) {
+        int got = Queue_pop_batch(queue, batch, BENCH_BATCH); 
+        if (got == 0) {
+            sched_yield(); 
+        }
+        popped += got; 
+    }
+    pthread_join(threads[0], NULL); 
+    report("Queue 1 producer, 1 consumer", now() - start); 
+    delete_Queue(queue); 
+
+    // MPMCQueue: same pattern on one thread 
+    MPMCQueue* mpmc = new_MPMCQueue(BENCH_DEPTH + 1); 
+    start = now(); 
+    for (int i = 0; i < BENCH_DEPTH; i++) {
+        MPMCQueue_push(mpmc, i); 
+    }
+    for (int i = BENCH_DEPTH; i < BENCH_COUNT; i++) {
+        MPMCQueue_push(mpmc, i); 
+        MPMCQueue_pop(mpmc, &value); 
+        sink += value; 
+    }
+    report("MPMCQueue push/pop", now() - start); 
+    delete_MPMCQueue(mpmc); 
+
+    // MPMCQueue: two producer and two consumer threads 
+    mpmc = new_MPMCQueue(BENCH_DEPTH * 16); 
+    start = now(); 
+    for (int i = 0; i < 2; i++) {
+        pthread_create(&threads[i], NULL, mpmcProducer, mpmc); 
+        pthread_create(&threads[2 + i], NULL, mpmcConsumer, mpmc); 
+    }
+    for (int i = 0; i < 4; i++) {
+        pthread_join(threads[i], NULL); 
+    }
+    report("MPMCQueue 2 producers, 2 consumers", now() - start); 
+    delete_MPMCQueue(mpmc); 
+
+    printf("(checksum %lld)\n", sink); 
+    return EXIT_SUCCESS;
+}
+
+double now(void) {
+    struct timespec ts; 
+    clock_gettime(CLOCK_MONOTONIC, &ts); 
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9; 
+}
+
+void report(const char* name, double seconds) {
+    printf("%-36s %8.3f s %8.1f Mops/s\n", name, seconds, BENCH_COUNT / seconds / 1e6);
+}
+
+void* spscProducer(void* arg) {
+    Queue* queue = (Queue*)arg; 
+    for (int i = 0; i < BENCH_COUNT; i++) {
+        while (Queue_push(queue, i) != LIST_OK) {
+            sched_yield(); 
+        }
+    }
+    return NULL; 
+}
+
+void* mpmcProducer(void* arg) {
+    MPMCQueue* queue = (MPMCQueue*)arg; 
+    for (int i = 0; i < BENCH_COUNT / 2; i++) { // each producer pushes half 
+        while (MPMCQueue_push(queue, i) != LIST_OK) {
+            sched_yield(); 
+        }
+    }
+    return NULL; 
+}
+
+void* mpmcConsumer(void* arg) {
+    MPMCQueue* queue = (MPMCQueue*)arg; 
+    int value = 0; 
+    for (int i = 0; i < BENCH_COUNT / 2; i++) {
+        while (MPMCQueue_pop(queue, &value) != LIST_OK) {
+            sched_yield(); 
+        }
+    }
+    return NULL; 
+}
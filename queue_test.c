@@ -0,0 +1,243 @@
+/**
+ * @file queue_test.c
+ * @author Joseph Allred 
+ * @brief tests for all methods implemented in queue.c 
+ * @date 2026-10-19 
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "queue.h"
+
+#define THREAD_COUNT 1000000
+
+// state handed to each MPMC producer thread 
+typedef struct ProducerArgs {
+    MPMCQueue* queue; 
+    int first;              // pushes first .. first + THREAD_COUNT - 1 
+} ProducerArgs; 
+
+// state handed to each MPMC consumer thread 
+typedef struct ConsumerArgs {
+    MPMCQueue* queue; 
+    unsigned char* hits;    // times each value was popped by this consumer 
+} ConsumerArgs; 
+
+void* spscProducer(void* arg);
+void* mpmcProducer(void* arg);
+void* mpmcConsumer(void* arg);
+
+int main(int argc, char* argv[]) {
+
+    //**************************************************************************
+    // TEST: new_Queue, Queue_push, Queue_pop, Queue_length
+    printf("Test queue push and pop:\n");
+    //**************************************************************************
+
+    if (new_Queue(0) == NULL) {
+        printf("queue of capacity 0 is rejected\n");
+    }
+    Queue* queue1 = new_Queue(3); 
+    printf("queue1 capacity rounded up to %zu\n", queue1->capacity);
+    int out = -1; 
+    if (Queue_pop(queue1, &out) == LIST_ERR_EMPTY && out == -1) {
+        printf("pop on empty queue1 reports LIST_ERR_EMPTY\n");
+    }
+    Queue_push(queue1, 1); 
+    Queue_push(queue1, 2); 
+    Queue_push(queue1, 3); 
+    printf("queue1 length after three pushes: %d\n", Queue_length(queue1));
+    Queue_pop(queue1, &out); 
+    printf("first value popped from queue1: %d\n", out);
+
+    int pushed = 0; 
+    while (Queue_push(queue1, pushed) == LIST_OK) {
+        pushed++; 
+    }
+    printf("queue1 full after %d more pushes, length %d\n", pushed, Queue_length(queue1));
+    printf("\n");
+
+    //**************************************************************************
+
+
+
+    //**************************************************************************
+    // TEST: Queue_pop_batch across chunk boundaries 
+    printf("Test queue batch pop:\n");
+    //**************************************************************************
+
+    int batch[QUEUE_CHUNK_SIZE * 2]; 
+    int got = Queue_pop_batch(queue1, batch, 2); 
+    printf("batch of 2 from queue1: %d %d (%d values)\n", batch[0], batch[1], got);
+
+    // wrap the ring several times and check FIFO order is kept 
+    Queue* queue2 = new_Queue(QUEUE_CHUNK_SIZE * 2); 
+    int next = 0; 
+    int expect = 0; 
+    bool ordered = true; 
+    for (int round = 0; round < 10; round++) {
+        while (Queue_push(queue2, next) == LIST_OK) {
+            next++; 
+        }
+        got = Queue_pop_batch(queue2, batch, QUEUE_CHUNK_SIZE + 7); 
+        for (int i = 0; i < got; i++) {
+            ordered = ordered && (batch[i] == expect++); 
+        }
+    }
+    while ((got = Queue_pop_batch(queue2, batch, QUEUE_CHUNK_SIZE * 2)) > 0) {
+        for (int i = 0; i < got; i++) {
+            ordered = ordered && (batch[i] == expect++); 
+        }
+    }
+    if (ordered && expect == next && Queue_length(queue2) == 0) {
+        printf("queue2 kept FIFO order for %d values across wraps\n", next);
+    }
+    printf("\n");
+
+    //**************************************************************************
+
+
+
+    //**************************************************************************
+    // TEST: Queue with a producer thread 
+    printf("Test queue with threads:\n");
+    //**************************************************************************
+
+    Queue* queue3 = new_Queue(1024); 
+    pthread_t producer; 
+    pthread_create(&producer, NULL, spscProducer, queue3); 
+    expect = 0; 
+    ordered = true; 
+    while (expect < THREAD_COUNT) {
+        got = Queue_pop_batch(queue3, batch, QUEUE_CHUNK_SIZE); 
+        if (got == 0) {
+            sched_yield(); 
+        }
+        for (int i = 0; i < got; i++) {
+            ordered = ordered && (batch[i] == expect++); 
+        }
+    }
+    pthread_join(producer, NULL); 
+    if (ordered) {
+        printf("consumer received %d values in order\n", expect);
+    }
+    printf("\n");
+
+    //**************************************************************************
+
+
+
+    //**************************************************************************
+    // TEST: MPMCQueue push, pop, batch pop 
+    printf("Test MPMC queue:\n");
+    //**************************************************************************
+
+    MPMCQueue* queue4 = new_MPMCQueue(2); 
+    if (MPMCQueue_pop(queue4, &out) == LIST_ERR_EMPTY) {
+        printf("pop on empty queue4 reports LIST_ERR_EMPTY\n");
+    }
+    pushed = 0; 
+    while (MPMCQueue_push(queue4, pushed) == LIST_OK) {
+        pushed++; 
+    }
+    printf("queue4 full after %d pushes\n", pushed);
+    MPMCQueue_pop(queue4, &out); 
+    got = MPMCQueue_pop_batch(queue4, batch, 3); 
+    printf("popped %d, then batch %d %d %d, length %d\n", out, batch[0], batch[1], batch[2], MPMCQueue_length(queue4));
+    printf("\n");
+
+    //**************************************************************************
+
+
+
+    //**************************************************************************
+    // TEST: MPMCQueue with two producers and two consumers 
+    printf("Test MPMC queue with threads:\n");
+    //**************************************************************************
+
+    MPMCQueue* queue5 = new_MPMCQueue(1024); 
+    pthread_t threads[4]; 
+    ProducerArgs producers[2] = { { queue5, 0 }, { queue5, THREAD_COUNT } }; 
+    ConsumerArgs consumers[2]; 
+    for (int i = 0; i < 2; i++) {
+        consumers[i].queue = queue5; 
+        consumers[i].hits = (unsigned char*)calloc(2 * THREAD_COUNT, 1); 
+    }
+    pthread_create(&threads[0], NULL, mpmcProducer, &producers[0]); 
+    pthread_create(&threads[1], NULL, mpmcProducer, &producers[1]); 
+    pthread_create(&threads[2], NULL, mpmcConsumer, &consumers[0]); 
+    pthread_create(&threads[3], NULL, mpmcConsumer, &consumers[1]); 
+    for (int i = 0; i < 4; i++) {
+        pthread_join(threads[i], NULL); 
+    }
+    int wrong = 0; // values popped zero times or more than once 
+    for (int v = 0; v < 2 * THREAD_COUNT; v++) {
+        wrong += (consumers[0].hits[v] + consumers[1].hits[v] != 1); 
+    }
+    free(consumers[0].hits); 
+    free(consumers[1].hits); 
+    if (wrong == 0) {
+        printf("consumers received every value exactly once\n");
+    }
+    printf("\n");
+
+    //**************************************************************************
+
+
+
+    //**************************************************************************
+    // TEST: delete_Queue, delete_MPMCQueue 
+    printf("Test delete:\n");
+    //**************************************************************************
+
+    delete_Queue(queue1); 
+    delete_Queue(queue2); 
+    delete_Queue(queue3); 
+    delete_MPMCQueue(queue4); 
+    delete_MPMCQueue(queue5); 
+
+    printf("all queues (should have been) successfuly deleted\n\n"); 
+
+    //**************************************************************************
+
+    return EXIT_SUCCESS;
+}
+
+void* spscProducer(void* arg) {
+    Queue* queue = (Queue*)arg; 
+    for (int i = 0; i < THREAD_COUNT; i++) {
+        while (Queue_push(queue, i) != LIST_OK) {
+            sched_yield(); // let the consumer free a slot 
+        }
+    }
+    return NULL; 
+}
+
+void* mpmcProducer(void* arg) {
+    ProducerArgs* producer = (ProducerArgs*)arg; 
+    for (int i = 0; i < THREAD_COUNT; i++) {
+        while (MPMCQueue_push(producer->queue, producer->first + i) != LIST_OK) {
+            sched_yield(); 
+        }
+    }
+    return NULL; 
+}
+
+void* mpmcConsumer(void* arg) {
+    ConsumerArgs* consumer = (ConsumerArgs*)arg; 
+    int value = 0; 
+    for (int i = 0; i < THREAD_COUNT; i++) { // each consumer takes an equal share 
+        while (MPMCQueue_pop(consumer->queue, &value) != LIST_OK) {
+            sched_yield(); 
+        }
+        if (value >= 0 && value < 2 * THREAD_COUNT && consumer->hits[value] < 255) {
+            consumer->hits[value]++; 
+        }
+    }
+    return NULL; 
+}
@@ -0,0 +1,493 @@
+/**
+ * @file shmlist.c
+ * @author Joseph Allred
+ * @brief Method implementations for shared-memory list module 
+ * @date 2026-10-19
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "shmlist.h"
+
+/**
+ * @brief Converts an offset into a node pointer for this process's mapping.
+ * 
+ * @param list   The handle the offset belongs to
+ * @param offset A non-zero node offset
+ * @return       The node at that offset
+ */
+static ShmNode* ShmList_node(ShmList* list, size_t offset) {
+    return (ShmNode*)((char*)list->header + offset); 
+}
+
+/**
+ * @brief Takes a node from the region, reusing released nodes first.
+ * 
+ * Every allocation is one ShmNode, so a free list plus a bump pointer is all 
+ * the allocator needs. Must be called with the write lock held.
+ * 
+ * @param list The handle on the region
+ * @param data The value to be stored in the node
+ * @return     The offset of the new node, or 0 if the region is full
+ */
+static size_t ShmList_alloc(ShmList* list, int data) {
+    ShmHeader* header = list->header; 
+    size_t offset = header->freeList; 
+    if (offset != 0) {
+        header->freeList = ShmList_node(list, offset)->next; 
+    } else if (header->brk + sizeof(ShmNode) <= header->size) {
+        offset = header->brk; 
+        header->brk += sizeof(ShmNode); 
+    } else {
+        return 0; 
+    }
+    ShmNode* node = ShmList_node(list, offset); 
+    node->data = data; 
+    node->next = 0; 
+    return offset; 
+}
+
+/**
+ * @brief Returns a node to the region's free list. Write lock must be held.
+ * 
+ * @param list   The handle on the region
+ * @param offset The offset of the node to be released
+ */
+static void ShmList_free(ShmList* list, size_t offset) {
+    ShmList_node(list, offset)->next = list->header->freeList; 
+    list->header->freeList = offset; 
+}
+
+/**
+ * @brief Maps an already open shared-memory object into this process.
+ * 
+ * @param name The name of the object, kept in the handle
+ * @param fd   An open descriptor for the object, closed before returning
+ * @param size The number of bytes to be mapped
+ * @return ShmList* to the new handle, or NULL on failure
+ */
+static ShmList* ShmList_map(const char* name, int fd, size_t size) {
+    void* base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0); 
+    close(fd); // the mapping stays valid without the descriptor 
+    if (base == MAP_FAILED) {
+        return NULL; 
+    }
+    ShmList* list = (ShmList*)malloc(sizeof(ShmList)); 
+    if (list == NULL) {
+        munmap(base, size); 
+        return NULL; 
+    }
+    list->header = (ShmHeader*)base; 
+    list->size = size; 
+    strcpy(list->name, name); 
+    return list; 
+}
+
+/**
+ * @brief Creates a new shared-memory region holding an empty list.
+ * 
+ * The region is sized for capacity nodes up front; it does not grow. Lists 
+ * created using this function should be cleaned up using delete_ShmList by 
+ * one process once every other process has detached.
+ * 
+ * @param name     A POSIX shared-memory name such as "/worklist"
+ * @param capacity The number of nodes the region can hold
+ * @return ShmList* to the new handle, or NULL if the name is invalid or taken, 
+ *         or the region could not be created
+ */
+ShmList* new_ShmList(const char* name, int capacity) {
+
+    if (name[0] != '/' || strlen(name) >= sizeof(((ShmList*)NULL)->name) || capacity <= 0) {
+        return NULL; 
+    }
+    size_t first = sizeof(ShmHeader) + _Alignof(ShmNode) - 1; 
+    first -= first % _Alignof(ShmNode); // first node offset, suitably aligned 
+    size_t size = first + (size_t)capacity * sizeof(ShmNode); 
+
+    int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600); 
+    if (fd < 0) {
+        return NULL; 
+    }
+    if (ftruncate(fd, (off_t)size) != 0) {
+        close(fd); 
+        shm_unlink(name); 
+        return NULL; 
+    }
+    ShmList* list = ShmList_map(name, fd, size); 
+    if (list == NULL) {
+        shm_unlink(name); 
+        return NULL; 
+    }
+
+    ShmHeader* header = list->header; 
+    pthread_rwlockattr_t attr; 
+    bool locked = (pthread_rwlockattr_init(&attr) == 0); 
+    if (locked) {
+        // without process-shared support the lock would only work within this process 
+        locked = (pthread_rwlockattr_setpshared(&attr, PTHREAD_PROCESS_SHARED) == 0) 
+                && (pthread_rwlock_init(&header->lock, &attr) == 0); 
+        pthread_rwlockattr_destroy(&attr); 
+    }
+    if (!locked) {
+        ShmList_detach(list); 
+        shm_unlink(name); 
+        return NULL; 
+    }
+    header->size = size; 
+    header->brk = first; 
+    header->freeList = 0; 
+    header->length = 0; 
+    header->head = 0; 
+    header->tail = 0; 
+    // written last with release order, so an attacher that sees the magic also 
+    // sees every store above, including the lock initialisation 
+    atomic_store_explicit(&header->magic, SHMLIST_MAGIC, memory_order_release); 
+    return list; 
+}
+
+/**
+ * @brief Maps a list created by another process, without copying it.
+ * 
+ * Handles returned by this function should be cleaned up using ShmList_detach.
+ * 
+ * @param name The name passed to new_ShmList
+ * @return ShmList* to the new handle, or NULL if no valid list has that name
+ */
+ShmList* ShmList_attach(const char* name) {
+
+    if (strlen(name) >= sizeof(((ShmList*)NULL)->name)) {
+        return NULL; 
+    }
+    int fd = shm_open(name, O_RDWR, 0); 
+    if (fd < 0) {
+        return NULL; 
+    }
+    struct stat st; 
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(ShmHeader)) {
+        close(fd); 
+        return NULL; 
+    }
+    ShmList* list = ShmList_map(name, fd, (size_t)st.st_size); 
+    if (list != NULL && (atomic_load_explicit(&list->header->magic, memory_order_acquire) != SHMLIST_MAGIC 
+            || list->header->size != list->size)) {
+        ShmList_detach(list); // not a region made by new_ShmList, or not finished 
+        return NULL; 
+    }
+    return list; 
+}
+
+/**
+ * @brief Unmaps the region from this process and frees the handle.
+ * 
+ * The list itself is unaffected and stays available to other processes.
+ * 
+ * @param list The handle to be released
+ */
+void ShmList_detach(ShmList* list) {
+    munmap(list->header, list->size); 
+    free(list); 
+}
+
+/**
+ * @brief Removes the list's name and releases this process's handle.
+ * 
+ * This also destroys the list's lock, so it must only be called once every 
+ * other process has finished with the list and detached.
+ * 
+ * @param list The handle of the list to be deleted
+ */
+void delete_ShmList(ShmList* list) {
+    pthread_rwlock_destroy(&list->header->lock); 
+    shm_unlink(list->name); 
+    ShmList_detach(list); 
+}
+
+/**
+ * @brief Appends the given value to the list in O(1).
+ * 
+ * @param list The list to which a value should be appended
+ * @param data The value to be appended to the list
+ * @return     LIST_OK, or LIST_ERR_FULL if the region has no free node
+ */
+ListStatus ShmList_append(ShmList* list, int data) {
+
+    ShmHeader* header = list->header; 
+    pthread_rwlock_wrlock(&header->lock); 
+    size_t offset = ShmList_alloc(list, data); 
+    if (offset != 0) {
+        if (header->tail == 0) {
+            header->head = offset; 
+        } else {
+            ShmList_node(list, header->tail)->next = offset; 
+        }
+        header->tail = offset; 
+        header->length += 1; 
+    }
+    pthread_rwlock_unlock(&header->lock); 
+    return (offset != 0) ? LIST_OK : LIST_ERR_FULL; 
+}
+
+/**
+ * @brief Prepends the given value to the list in O(1).
+ * 
+ * @param list The list to which a value should be prepended
+ * @param data The value to be prepended to the list
+ * @return     LIST_OK, or LIST_ERR_FULL if the region has no free node
+ */
+ListStatus ShmList_prepend(ShmList* list, int data) {
+
+    ShmHeader* header = list->header; 
+    pthread_rwlock_wrlock(&header->lock); 
+    size_t offset = ShmList_alloc(list, data); 
+    if (offset != 0) {
+        ShmList_node(list, offset)->next = header->head; 
+        header->head = offset; 
+        if (header->tail == 0) {
+            header->tail = offset; 
+        }
+        header->length += 1; 
+    }
+    pthread_rwlock_unlock(&header->lock); 
+    return (offset != 0) ? LIST_OK : LIST_ERR_FULL; 
+}
+
+/**
+ * @brief Appends every value of a private List, taking the lock only once.
+ * 
+ * Either all values are appended or, if the region cannot hold them all, none.
+ * 
+ * @param list   The shared list to be extended
+ * @param source The list whose values are copied, left unchanged
+ * @return       LIST_OK, or LIST_ERR_FULL if the values do not fit
+ */
+ListStatus ShmList_extend_from_List(ShmList* list, List* source) {
+
+    ShmHeader* header = list->header; 
+    pthread_rwlock_wrlock(&header->lock); 
+    size_t first = 0; 
+    size_t last = 0; 
+    for (Node* cursor = source->head; cursor != NULL; cursor = cursor->next) {
+        size_t offset = ShmList_alloc(list, cursor->data); 
+        if (offset == 0) {
+            while (first != 0) { // give back what was taken so far 
+                size_t next = ShmList_node(list, first)->next; 
+                ShmList_free(list, first); 
+                first = next; 
+            }
+            pthread_rwlock_unlock(&header->lock); 
+            return LIST_ERR_FULL; 
+        }
+        if (last == 0) {
+            first = offset; 
+        } else {
+            ShmList_node(list, last)->next = offset; 
+        }
+        last = offset; 
+    }
+    if (first != 0) {
+        if (header->tail == 0) {
+            header->head = first; 
+        } else {
+            ShmList_node(list, header->tail)->next = first; 
+        }
+        header->tail = last; 
+        header->length += source->length; 
+    }
+    pthread_rwlock_unlock(&header->lock); 
+    return LIST_OK; 
+}
+
+/**
+ * @brief Retrieves the value of the ith node under the read lock.
+ * 
+ * @param list  The list to be indexed for the element
+ * @param index The index of the node to be retrieved
+ * @param out   Receives the value in the node, untouched on failure
+ * @return      LIST_OK, LIST_ERR_EMPTY or LIST_ERR_INDEX
+ */
+ListStatus ShmList_try_get(ShmList* list, int index, int* out) {
+
+    ShmHeader* header = list->header; 
+    ListStatus status = LIST_OK; 
+    pthread_rwlock_rdlock(&header->lock); 
+    if (header->head == 0) {
+        status = LIST_ERR_EMPTY; 
+    } else if (index < 0 || index >= header->length) {
+        status = LIST_ERR_INDEX; 
+    } else {
+        size_t offset = header->head; 
+        for (int i = 0; i < index; i++) {
+            offset = ShmList_node(list, offset)->next; 
+        }
+        *out = ShmList_node(list, offset)->data; 
+    }
+    pthread_rwlock_unlock(&header->lock); 
+    return status; 
+}
+
+/**
+ * @brief Removes the node at the given index and returns it to the region.
+ * 
+ * @param list  The list from which a node will be removed
+ * @param index The index of the node to be removed
+ * @param out   Receives the removed value, may be NULL to discard it
+ * @return      LIST_OK, LIST_ERR_EMPTY or LIST_ERR_INDEX
+ */
+ListStatus ShmList_try_remove(ShmList* list, int index, int* out) {
+
+    ShmHeader* header = list->header; 
+    ListStatus status = LIST_OK; 
+    pthread_rwlock_wrlock(&header->lock); 
+    if (header->head == 0) {
+        status = LIST_ERR_EMPTY; 
+    } else if (index < 0 || index >= header->length) {
+        status = LIST_ERR_INDEX; 
+    } else {
+        size_t prev = 0; 
+        size_t offset = header->head; 
+        for (int i = 0; i < index; i++) {
+            prev = offset; 
+            offset = ShmList_node(list, offset)->next; 
+        }
+        ShmNode* node = ShmList_node(list, offset); 
+        if (prev == 0) {
+            header->head = node->next; 
+        } else {
+            ShmList_node(list, prev)->next = node->next; 
+        }
+        if (offset == header->tail) {
+            header->tail = prev; 
+        }
+        if (out != NULL) {
+            *out = node->data; 
+        }
+        ShmList_free(list, offset); 
+        header->length -= 1; 
+    }
+    pthread_rwlock_unlock(&header->lock); 
+    return status; 
+}
+
+/**
+ * @brief Checks whether or not the list contains the given value
+ * 
+ * @param list   The list to be checked for the item
+ * @param value  The value for which the list should be searched
+ * @return true  If the list contains the item
+ */
+bool ShmList_contains(ShmList* list, int value) {
+
+    ShmHeader* header = list->header; 
+    bool found = false; 
+    pthread_rwlock_rdlock(&header->lock); 
+    for (size_t offset = header->head; offset != 0 && !found; offset = ShmList_node(list, offset)->next) {
+        found = (ShmList_node(list, offset)->data == value); 
+    }
+    pthread_rwlock_unlock(&header->lock); 
+    return found; 
+}
+
+/**
+ * @brief Returns the number of values in the list.
+ * 
+ * @param list The list to be measured
+ * @return     The length of the list
+ */
+int ShmList_length(ShmList* list) {
+    pthread_rwlock_rdlock(&list->header->lock); 
+    int length = list->header->length; 
+    pthread_rwlock_unlock(&list->header->lock); 
+    return length; 
+}
+
+/**
+ * @brief Returns every node to the region's free list in O(1).
+ * 
+ * @param list the list to be reset to an empty list
+ */
+void ShmList_clear(ShmList* list) {
+
+    ShmHeader* header = list->header; 
+    pthread_rwlock_wrlock(&header->lock); 
+    if (header->head != 0) {
+        ShmList_node(list, header->tail)->next = header->freeList; // the whole chain joins the free list 
+        header->freeList = header->head; 
+    }
+    header->head = 0; 
+    header->tail = 0; 
+    header->length = 0; 
+    pthread_rwlock_unlock(&header->lock); 
+}
+
+/**
+ * @brief Prints out an entire list
+ * 
+ * @param list the list to be printed
+ */
+void ShmList_print(ShmList* list) {
+
+    ShmHeader* header = list->header; 
+    pthread_rwlock_rdlock(&header->lock); 
+    printf("[ ");
+    for (size_t offset = header->head; offset != 0; offset = ShmList_node(list, offset)->next) {
+        printf("%d ", ShmList_node(list, offset)->data);
+    }
+    printf("]\n");
+    pthread_rwlock_unlock(&header->lock); 
+}
+
+/**
+ * @brief Calls fn on every value in order, all under a single read lock.
+ * 
+ * This is the way for an attached process to read the whole list: one O(n) 
+ * pass over a consistent snapshot, with no copying. fn must not call other 
+ * ShmList methods on the same list.
+ * 
+ * @param list The list to be read
+ * @param fn   Called with ctx and each value in turn
+ * @param ctx  Passed through to fn unchanged
+ * @return     The number of values visited
+ */
+int ShmList_for_each(ShmList* list, void (*fn)(void* ctx, int value), void* ctx) {
+
+    ShmHeader* header = list->header; 
+    pthread_rwlock_rdlock(&header->lock); 
+    int count = 0; 
+    for (size_t offset = header->head; offset != 0; offset = ShmList_node(list, offset)->next) {
+        fn(ctx, ShmList_node(list, offset)->data); 
+        count++; 
+    }
+    pthread_rwlock_unlock(&header->lock); 
+    return count; 
+}
+
+/**
+ * @brief Copies up to max values into a private array under a single read lock.
+ * 
+ * @param list The list to be read
+ * @param out  Receives the values in order, room for at least max values
+ * @param max  The largest number of values to be copied
+ * @return     The number of values copied
+ */
+int ShmList_copy_to(ShmList* list, int* out, int max) {
+
+    ShmHeader* header = list->header; 
+    pthread_rwlock_rdlock(&header->lock); 
+    int count = 0; 
+    for (size_t offset = header->head; offset != 0 && count < max; offset = ShmList_node(list, offset)->next) {
+        out[count++] = ShmList_node(list, offset)->data; 
+    }
+    pthread_rwlock_unlock(&header->lock); 
+    return count; 
+}
@@ -0,0 +1,80 @@
+/**
+ * @file shmlist.h
+ * @author Joseph Allred 
+ * @brief Struct and method declarations for shared-memory list module 
+ * @date 2026-10-19
+ */
+
+#ifndef COMP230_SHMLIST_H
+#define COMP230_SHMLIST_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "linklist.h"
+
+/* users of this module need POSIX declarations (shm_open, process-shared 
+ * locks), so define _POSIX_C_SOURCE 200809L before including it */
+
+// identifies a region created by new_ShmList 
+#define SHMLIST_MAGIC 0x4c4d4853u
+
+/* definition for ShmNode 
+ *
+ * Processes map the region at different addresses, so links are byte offsets 
+ * from the start of the region rather than pointers. Offset 0 is the header 
+ * and never a node, so it plays the role of NULL. */
+typedef struct ShmNode {
+    int data; 
+    size_t next; 
+} ShmNode; 
+
+/* definition for ShmHeader, stored at the start of the shared region 
+ *
+ * The lock is a process-shared rwlock, which keeps readers concurrent but is 
+ * not robust: if a process dies while holding it, in particular during a 
+ * write, every other process using the list blocks forever. Workers that may 
+ * be killed should only read, or the list should be rebuilt under a new name. */
+typedef struct ShmHeader {
+    _Atomic uint32_t magic;     // set last, with release order, once the region is ready 
+    size_t size;                // bytes in the region 
+    size_t brk;                 // offset of the first never-used byte 
+    size_t freeList;            // offset of the first released node, 0 if none 
+    pthread_rwlock_t lock;      // process-shared, held by every method, not robust 
+    int length; 
+    size_t head; 
+    size_t tail; 
+} ShmHeader; 
+
+// definition for ShmList, one process's handle on a shared region 
+typedef struct ShmList {
+    ShmHeader* header;          // where this process mapped the region 
+    size_t size; 
+    char name[64]; 
+} ShmList; 
+
+// ShmList constructor methods 
+ShmList* new_ShmList(const char* name, int capacity);
+ShmList* ShmList_attach(const char* name);
+void ShmList_detach(ShmList* list);
+void delete_ShmList(ShmList* list);
+
+// methods supported by shared-memory list 
+ListStatus ShmList_append(ShmList* list, int data);
+ListStatus ShmList_prepend(ShmList* list, int data);
+ListStatus ShmList_extend_from_List(ShmList* list, List* source);
+ListStatus ShmList_try_get(ShmList* list, int index, int* out);
+ListStatus ShmList_try_remove(ShmList* list, int index, int* out);
+bool ShmList_contains(ShmList* list, int value);
+int ShmList_for_each(ShmList* list, void (*fn)(void* ctx, int value), void* ctx);
+int ShmList_copy_to(ShmList* list, int* out, int max);
+int ShmList_length(ShmList* list);
+void ShmList_clear(ShmList* list);
+void ShmList_print(ShmList* list);
+
+#endif /* COMP230_SHMLIST_H */
@@ -0,0 +1,142 @@
+/**
+ * @file shmlist_test.c
+ * @author Joseph Allred 
+ * @brief tests for all methods implemented in shmlist.c 
+ * @date 2026-10-19 
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "shmlist.h"
+
+void addValue(void* ctx, int value);
+
+int main(int argc, char* argv[]) {
+
+    char name[32]; 
+    snprintf(name, sizeof(name), "/shmlist_test_%d", (int)getpid()); 
+
+    //**************************************************************************
+    // TEST: new_ShmList, ShmList_append, ShmList_prepend, ShmList_extend_from_List
+    printf("Test build:\n");
+    //**************************************************************************
+
+    if (new_ShmList("no_slash", 4) == NULL) {
+        printf("names without a leading slash are rejected\n");
+    }
+    ShmList* list1 = new_ShmList(name, 8); 
+    if (new_ShmList(name, 8) == NULL) {
+        printf("a name that is already in use is rejected\n");
+    }
+    ShmList_append(list1, 2); 
+    ShmList_append(list1, 3); 
+    ShmList_prepend(list1, 1); 
+    List* source = new_List(); 
+    List_append(source, 4); 
+    List_append(source, 5); 
+    ShmList_extend_from_List(list1, source); 
+    printf("list1: ");
+    ShmList_print(list1); 
+
+    List_append(source, 6); 
+    List_append(source, 7); // four more values do not fit in the remaining three nodes 
+    if (ShmList_extend_from_List(list1, source) == LIST_ERR_FULL && ShmList_length(list1) == 5) {
+        printf("extend that does not fit leaves list1 unchanged\n");
+    }
+    printf("\n");
+
+    //**************************************************************************
+
+
+
+    //**************************************************************************
+    // TEST: ShmList_attach from another process 
+    printf("Test attach:\n");
+    //**************************************************************************
+
+    fflush(stdout); // keep buffered output from being printed twice 
+    pid_t child = fork(); 
+    if (child == 0) {
+        ShmList* view = ShmList_attach(name); 
+        if (view == NULL) {
+            _exit(1); 
+        }
+        int sum = 0; 
+        int count = ShmList_for_each(view, addValue, &sum); // one pass under one read lock 
+        printf("child sees %d values summing to %d\n", count, sum);
+        int copy[8]; 
+        int copied = ShmList_copy_to(view, copy, 3); 
+        printf("child copied %d values: %d %d %d\n", copied, copy[0], copy[1], copy[2]);
+        ShmList_append(view, 100); // write back for the parent to see 
+        ShmList_detach(view); 
+        fflush(stdout); 
+        _exit(0); 
+    }
+    int status = 0; 
+    waitpid(child, &status, 0); 
+    if (WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+        printf("list1 after child appended: ");
+        ShmList_print(list1); 
+    }
+    if (ShmList_attach("/shmlist_test_missing") == NULL) {
+        printf("attaching to a missing list fails\n");
+    }
+    printf("\n");
+
+    //**************************************************************************
+
+
+
+    //**************************************************************************
+    // TEST: ShmList_try_get, ShmList_try_remove, ShmList_contains, ShmList_clear
+    printf("Test remove and clear:\n");
+    //**************************************************************************
+
+    int out = -1; 
+    if (ShmList_try_get(list1, 6, &out) == LIST_ERR_INDEX && out == -1) {
+        printf("try_get at index 6 reports LIST_ERR_INDEX\n");
+    }
+    ShmList_try_remove(list1, 5, &out); // remove the tail 
+    printf("removed %d, list1: ", out);
+    ShmList_print(list1); 
+    ShmList_try_remove(list1, 0, NULL); 
+    ShmList_append(list1, 6); // reuses a released node, tail must be correct 
+    printf("list1: ");
+    ShmList_print(list1); 
+    if (ShmList_contains(list1, 6) && !ShmList_contains(list1, 1)) {
+        printf("list1 contains 6 but not 1\n");
+    }
+
+    ShmList_clear(list1); 
+    int added = 0; 
+    while (ShmList_append(list1, added) == LIST_OK) {
+        added++; 
+    }
+    if (ShmList_try_remove(list1, 0, &out) == LIST_OK && added == 8) {
+        printf("cleared region holds all %d nodes again\n", added);
+    }
+    ShmList_clear(list1); 
+    if (ShmList_try_get(list1, 0, &out) == LIST_ERR_EMPTY) {
+        printf("try_get on cleared list reports LIST_ERR_EMPTY\n");
+    }
+    printf("\n");
+
+    //**************************************************************************
+
+    delete_List(source); 
+    delete_ShmList(list1); 
+    if (ShmList_attach(name) == NULL) {
+        printf("list1 (should have been) successfuly deleted\n\n");
+    }
+
+    return EXIT_SUCCESS;
+}
+
+void addValue(void* ctx, int value) {
+    *(int*)ctx += value; 
+}
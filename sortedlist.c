@@ -0,0 +1,448 @@
+/**
+ * @file sortedlist.c
+ * @author Joseph Allred
+ * @brief Method implementations for sorted-list mode and set operations 
+ * @date 2026-10-19
+ */
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "sortedlist.h"
+
+/**
+ * @brief Builds a skip index over a sorted list in one pass.
+ * 
+ * Indexes constructed using this function should be cleaned up using 
+ * delete_SkipIndex, and rebuilt after the list is modified.
+ * 
+ * @param list The sorted list to be indexed
+ * @return SkipIndex* to the new index, or NULL if allocation failed
+ */
+SkipIndex* new_SkipIndex(List* list) {
+
+    SkipIndex* index = (SkipIndex*)malloc(sizeof(SkipIndex)); 
+    if (index == NULL) {
+        return NULL; 
+    }
+    index->count = (list->length + SKIP_STRIDE - 1) / SKIP_STRIDE; 
+    index->keys = (int*)malloc(sizeof(int) * (size_t)(index->count + 1)); 
+    index->nodes = (Node**)malloc(sizeof(Node*) * (size_t)(index->count + 1)); 
+    if (index->keys == NULL || index->nodes == NULL) {
+        delete_SkipIndex(index); 
+        return NULL; 
+    }
+    int i = 0; 
+    int pos = 0; 
+    for (Node* cursor = list->head; cursor != NULL; cursor = cursor->next) {
+        if (pos % SKIP_STRIDE == 0) {
+            index->keys[i] = cursor->data; 
+            index->nodes[i] = cursor; 
+            i++; 
+        }
+        pos++; 
+    }
+    return index; 
+}
+
+/**
+ * @brief Deletes a skip index. The list it was built from is not affected.
+ * 
+ * @param index The index to be deleted
+ */
+void delete_SkipIndex(SkipIndex* index) {
+    free(index->keys); 
+    free(index->nodes); 
+    free(index); 
+}
+
+/**
+ * @brief Finds the last sampled key not greater than value, starting at from.
+ * 
+ * Probes from, from+1, from+3, from+7, ... until a key passes value, then 
+ * binary searches the last gap. The cost is O(log d) where d is the distance 
+ * moved, which is what makes many ordered lookups into a much longer list cheap.
+ * 
+ * @param index The index to be searched, with from < count
+ * @param from  The first sample that may be returned
+ * @param value The value being looked for
+ * @return      The sample position, or from - 1 if keys[from] > value
+ */
+static int SkipIndex_gallop(SkipIndex* index, int from, int value) {
+
+    if (index->keys[from] > value) {
+        return from - 1; 
+    }
+    int lo = from;              // keys[lo] <= value 
+    int step = 1; 
+    while (lo + step < index->count && index->keys[lo + step] <= value) {
+        lo += step; 
+        step *= 2; 
+    }
+    int hi = (lo + step < index->count) ? lo + step : index->count; // keys[hi] > value, or hi is count 
+    while (hi - lo > 1) {
+        int mid = lo + (hi - lo) / 2; 
+        if (index->keys[mid] <= value) {
+            lo = mid; 
+        } else {
+            hi = mid; 
+        }
+    }
+    return lo; 
+}
+
+/**
+ * @brief Checks whether value lies in the stretch of nodes covered by a sample.
+ * 
+ * @param index  The index holding the sample
+ * @param sample The sample position returned by SkipIndex_gallop
+ * @param value  The value being looked for
+ * @return true  If one of the at most SKIP_STRIDE nodes holds value
+ */
+static bool SkipIndex_scan(SkipIndex* index, int sample, int value) {
+    Node* cursor = index->nodes[sample]; 
+    for (int i = 0; i < SKIP_STRIDE && cursor != NULL && cursor->data <= value; i++) {
+        if (cursor->data == value) {
+            return true; 
+        }
+        cursor = cursor->next; 
+    }
+    return false; 
+}
+
+/**
+ * @brief Checks whether a list is in sorted-list mode.
+ * 
+ * @param list   The list to be checked
+ * @return true  If every value is strictly greater than the one before it
+ */
+bool List_is_sorted(List* list) {
+    for (Node* cursor = list->head; cursor != NULL && cursor->next != NULL; cursor = cursor->next) {
+        if (cursor->data >= cursor->next->data) {
+            return false; 
+        }
+    }
+    return true; 
+}
+
+/**
+ * @brief Merges two sorted runs of nodes into one, keeping duplicates.
+ * 
+ * @param a The first run, NULL terminated
+ * @param b The second run, NULL terminated
+ * @return  The first node of the merged run
+ */
+static Node* List_merge_runs(Node* a, Node* b) {
+    Node head; 
+    Node* last = &head; 
+    while (a != NULL && b != NULL) {
+        if (a->data <= b->data) {
+            last->next = a; 
+            a = a->next; 
+        } else {
+            last->next = b; 
+            b = b->next; 
+        }
+        last = last->next; 
+    }
+    last->next = (a != NULL) ? a : b; 
+    return head.next; 
+}
+
+/**
+ * @brief Merge sorts a run of nodes.
+ * 
+ * @param first  The first node of the run
+ * @param length The number of nodes in the run
+ * @return       The first node of the sorted run
+ */
+static Node* List_sort_run(Node* first, int length) {
+    if (length <= 1) {
+        if (first != NULL) {
+            first->next = NULL; 
+        }
+        return first; 
+    }
+    int half = length / 2; 
+    Node* second = first; 
+    for (int i = 0; i < half; i++) {
+        second = second->next; 
+    }
+    Node* left = List_sort_run(first, half); // terminates the left half, so sort it after finding second 
+    Node* right = List_sort_run(second, length - half); 
+    return List_merge_runs(left, right); 
+}
+
+/**
+ * @brief Puts an existing list into sorted-list mode.
+ * 
+ * The nodes are merge sorted in place in O(n log n) and every duplicate value 
+ * is removed and freed, leaving a strictly ascending list.
+ * 
+ * @param list The list to be sorted
+ */
+void List_sort_unique(List* list) {
+
+    list->head = List_sort_run(list->head, list->length); 
+    list->tail = list->head; 
+    list->length = (list->head != NULL) ? 1 : 0; 
+    Node* cursor = list->head; 
+    while (cursor != NULL && cursor->next != NULL) {
+        if (cursor->next->data == cursor->data) {
+            Node* dup = cursor->next; 
+            cursor->next = dup->next; 
+            delete_Node(dup); 
+        } else {
+            cursor = cursor->next; 
+            list->tail = cursor; 
+            list->length += 1; 
+        }
+    }
+}
+
+/**
+ * @brief Inserts a value into a sorted list, keeping it sorted and unique.
+ * 
+ * @param list  The sorted list to be inserted into
+ * @param value The value to be inserted
+ * @return true  If the value was added
+ * @return false If the value was already present, or allocation failed
+ */
+bool List_insert_sorted(List* list, int value) {
+
+    if (list->tail != NULL && list->tail->data < value) { // appending in order is O(1) 
+        int before = list->length; 
+        List_append(list, value); 
+        return list->length > before; // unchanged if no node could be allocated 
+    }
+    Node* prev = NULL; 
+    Node* cursor = list->head; 
+    while (cursor != NULL && cursor->data < value) {
+        prev = cursor; 
+        cursor = cursor->next; 
+    }
+    if (cursor != NULL && cursor->data == value) {
+        return false; // already present 
+    }
+    Node* newNode = new_Node(value); 
+    if (newNode == NULL) {
+        return false; 
+    }
+    newNode->next = cursor; 
+    if (prev == NULL) {
+        list->head = newNode; 
+    } else {
+        prev->next = newNode; 
+    }
+    if (cursor == NULL) {
+        list->tail = newNode; 
+    }
+    list->length += 1; 
+    return true; 
+}
+
+/**
+ * @brief Checks whether a sorted list contains a value.
+ * 
+ * Without an index the scan stops at the first larger value; with one the 
+ * lookup is O(log n + SKIP_STRIDE).
+ * 
+ * @param list   The sorted list to be searched
+ * @param index  A current index over list, or NULL
+ * @param value  The value for which the list should be searched
+ * @return true  If the list contains the value
+ */
+bool List_contains_sorted(List* list, SkipIndex* index, int value) {
+
+    if (index != NULL) {
+        if (index->count == 0) {
+            return false; 
+        }
+        int sample = SkipIndex_gallop(index, 0, value); 
+        return sample >= 0 && SkipIndex_scan(index, sample, value); 
+    }
+    for (Node* cursor = list->head; cursor != NULL && cursor->data <= value; cursor = cursor->next) {
+        if (cursor->data == value) {
+            return true; 
+        }
+    }
+    return false; 
+}
+
+/**
+ * @brief Appends a value to a set operation's result, giving up on failure.
+ * 
+ * If no node can be allocated the partial result is deleted and set to NULL, 
+ * so callers never return a truncated set that looks valid.
+ * 
+ * @param result The result being built, NULL afterwards on failure
+ * @param value  The value to be appended
+ * @return true  If the value was appended
+ */
+static bool List_append_result(List** result, int value) {
+    int before = (*result)->length; 
+    List_append(*result, value); 
+    if ((*result)->length == before) {
+        delete_List(*result); 
+        *result = NULL; 
+        return false; 
+    }
+    return true; 
+}
+
+/**
+ * @brief Looks up every value of a short list in a much longer indexed one.
+ * 
+ * Values of listA are visited in order, so each gallop resumes from where the 
+ * previous one stopped and the whole pass costs O(m log(n/m) + m * SKIP_STRIDE).
+ * 
+ * @param listA  The short sorted list
+ * @param indexB A current index over the long sorted list
+ * @param keep   Whether values found in listB (true) or missing from it 
+ *               (false) are kept
+ * @return       A new sorted list with the kept values of listA, or NULL if 
+ *               allocation failed
+ */
+static List* List_gallop_filter(List* listA, SkipIndex* indexB, bool keep) {
+
+    List* result = new_List(); 
+    if (result == NULL) {
+        return NULL; 
+    }
+    int sample = 0; 
+    for (Node* a = listA->head; a != NULL; a = a->next) {
+        bool found = false; 
+        if (indexB->count > 0) {
+            int foundAt = SkipIndex_gallop(indexB, sample, a->data); 
+            if (foundAt >= sample) {
+                sample = foundAt; 
+                found = SkipIndex_scan(indexB, sample, a->data); 
+            }
+        }
+        if (found == keep) {
+            if (!List_append_result(&result, a->data)) { 
+                return NULL; 
+            }
+        }
+    }
+    return result; 
+}
+
+/**
+ * @brief Returns the values present in both sorted lists.
+ * 
+ * A linear merge is used unless an index over listB is given and listB is at 
+ * least GALLOP_RATIO times longer than listA, in which case listA's values are 
+ * galloped through the index instead. Pass the longer list as listB.
+ * 
+ * @param listA  A sorted list
+ * @param listB  A sorted list
+ * @param indexB A current index over listB, or NULL
+ * @return       A new sorted list to be cleaned up using delete_List, or NULL 
+ *               if allocation failed
+ */
+List* List_intersect(List* listA, List* listB, SkipIndex* indexB) {
+
+    if (indexB != NULL && (long long)listA->length * GALLOP_RATIO <= listB->length) {
+        return List_gallop_filter(listA, indexB, true); 
+    }
+    List* result = new_List(); 
+    if (result == NULL) {
+        return NULL; 
+    }
+    Node* a = listA->head; 
+    Node* b = listB->head; 
+    while (a != NULL && b != NULL) {
+        if (a->data < b->data) {
+            a = a->next; 
+        } else if (b->data < a->data) {
+            b = b->next; 
+        } else {
+            if (!List_append_result(&result, a->data)) { 
+                return NULL; 
+            }
+            a = a->next; 
+            b = b->next; 
+        }
+    }
+    return result; 
+}
+
+/**
+ * @brief Returns the values present in either sorted list.
+ * 
+ * Every value ends up in the result, so this is always a linear merge.
+ * 
+ * @param listA  A sorted list
+ * @param listB  A sorted list
+ * @return       A new sorted list to be cleaned up using delete_List, or NULL 
+ *               if allocation failed
+ */
+List* List_union(List* listA, List* listB) {
+
+    List* result = new_List(); 
+    if (result == NULL) {
+        return NULL; 
+    }
+    Node* a = listA->head; 
+    Node* b = listB->head; 
+    while (a != NULL || b != NULL) {
+        if (b == NULL || (a != NULL && a->data < b->data)) {
+            if (!List_append_result(&result, a->data)) { 
+                return NULL; 
+            }
+            a = a->next; 
+        } else if (a == NULL || b->data < a->data) {
+            if (!List_append_result(&result, b->data)) { 
+                return NULL; 
+            }
+            b = b->next; 
+        } else {
+            if (!List_append_result(&result, a->data)) { // present in both, keep one 
+                return NULL; 
+            }
+            a = a->next; 
+            b = b->next; 
+        }
+    }
+    return result; 
+}
+
+/**
+ * @brief Returns the values of listA that are not in listB.
+ * 
+ * As with List_intersect, galloping through indexB replaces the linear merge 
+ * when listB is at least GALLOP_RATIO times longer than listA.
+ * 
+ * @param listA  The sorted list whose values are kept
+ * @param listB  The sorted list whose values are taken away
+ * @param indexB A current index over listB, or NULL
+ * @return       A new sorted list to be cleaned up using delete_List, or NULL 
+ *               if allocation failed
+ */
+List* List_difference(List* listA, List* listB, SkipIndex* indexB) {
+
+    if (indexB != NULL && (long long)listA->length * GALLOP_RATIO <= listB->length) {
+        return List_gallop_filter(listA, indexB, false); 
+    }
+    List* result = new_List(); 
+    if (result == NULL) {
+        return NULL; 
+    }
+    Node* a = listA->head; 
+    Node* b = listB->head; 
+    while (a != NULL) {
+        if (b == NULL || a->data < b->data) {
+            if (!List_append_result(&result, a->data)) { 
+                return NULL; 
+            }
+            a = a->next; 
+        } else if (b->data < a->data) {
+            b = b->next; 
+        } else {
+            a = a->next; 
+            b = b->next; 
+        }
+    }
+    return result; 
+}
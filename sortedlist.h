@@ -0,0 +1,50 @@
+/**
+ * @file sortedlist.h
+ * @author Joseph Allred 
+ * @brief Struct and method declarations for sorted-list mode and set operations 
+ * @date 2026-10-19
+ */
+
+#ifndef COMP230_SORTEDLIST_H
+#define COMP230_SORTEDLIST_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+
+#include "linklist.h"
+
+// one node out of every SKIP_STRIDE is recorded in a SkipIndex 
+#define SKIP_STRIDE 8
+
+// galloping is used once the indexed list is this many times longer 
+#define GALLOP_RATIO 16
+
+/* definition for SkipIndex 
+ *
+ * A sampled array over a sorted list: keys[i] and nodes[i] are the value and 
+ * node at position i * SKIP_STRIDE. Searching the array and then walking at 
+ * most SKIP_STRIDE nodes finds any value without scanning the whole list. The 
+ * index is only valid until the list it was built from is next modified. */
+typedef struct SkipIndex {
+    int count; 
+    int* keys; 
+    Node** nodes; 
+} SkipIndex; 
+
+// SkipIndex constructor methods 
+SkipIndex* new_SkipIndex(List* list);
+void delete_SkipIndex(SkipIndex* index);
+
+// sorted-list mode, lists hold strictly ascending values without duplicates 
+bool List_is_sorted(List* list);
+void List_sort_unique(List* list);
+bool List_insert_sorted(List* list, int value);
+bool List_contains_sorted(List* list, SkipIndex* index, int value);
+
+// set operations on sorted lists, each returns a new sorted list 
+List* List_intersect(List* listA, List* listB, SkipIndex* indexB);
+List* List_union(List* listA, List* listB);
+List* List_difference(List* listA, List* listB, SkipIndex* indexB);
+
+#endif /* COMP230_SORTEDLIST_H */
@@ -0,0 +1,99 @@
+/**
+ * @file sortedlist_bench.c
+ * @author Joseph Allred 
+ * @brief intersection cost of sortedlist.c at different size ratios 
+ * @date 2026-10-19 
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "sortedlist.h"
+
+#define BENCH_LARGE 1000000
+#define BENCH_NAIVE_LIMIT 100   // List_contains is O(n) per value, skip it for larger lists 
+
+double now(void);
+List* buildSorted(int count, int spread);
+
+int main(int argc, char* argv[]) {
+
+    srand(230); 
+    List* large = buildSorted(BENCH_LARGE, 4); 
+    double start = now(); 
+    SkipIndex* index = new_SkipIndex(large); 
+    printf("large list %d values, index built in %.3f ms\n\n", large->length, (now() - start) * 1e3);
+
+    printf("%8s %8s %12s %12s %12s\n", "ratio", "small", "naive ms", "merge ms", "gallop ms");
+    int ratios[] = { 1, 10, 100, 1000, 10000, 100000 }; 
+    for (int r = 0; r < 6; r++) {
+        List* small = buildSorted(BENCH_LARGE / ratios[r], 4 * ratios[r]); 
+        int reps = (ratios[r] >= 1000) ? 100 : 5; // repeat the quick runs so they are measurable 
+
+        double naive = -1.0; 
+        if (small->length <= BENCH_NAIVE_LIMIT) {
+            start = now(); 
+            for (int rep = 0; rep < reps; rep++) {
+                List* result = new_List(); 
+                for (Node* cursor = small->head; cursor != NULL; cursor = cursor->next) {
+                    if (List_contains(large, cursor->data)) {
+                        List_append(result, cursor->data); 
+                    }
+                }
+                delete_List(result); 
+            }
+            naive = (now() - start) * 1e3 / reps; 
+        }
+
+        start = now(); 
+        int mergedLength = 0; 
+        for (int rep = 0; rep < reps; rep++) {
+            List* result = List_intersect(small, large, NULL); 
+            mergedLength = result->length; 
+            delete_List(result); 
+        }
+        double merge = (now() - start) * 1e3 / reps; 
+
+        start = now(); 
+        int gallopedLength = 0; 
+        for (int rep = 0; rep < reps; rep++) {
+            List* result = List_intersect(small, large, index); 
+            gallopedLength = result->length; 
+            delete_List(result); 
+        }
+        double gallop = (now() - start) * 1e3 / reps; 
+
+        if (naive < 0) {
+            printf("%8d %8d %12s %12.3f %12.3f", ratios[r], small->length, "-", merge, gallop);
+        } else {
+            printf("%8d %8d %12.3f %12.3f %12.3f", ratios[r], small->length, naive, merge, gallop);
+        }
+        printf("%s\n", (mergedLength == gallopedLength) ? "" : "  MISMATCH");
+        delete_List(small); 
+    }
+    printf("\ngallop falls back to merge below a ratio of %d\n", GALLOP_RATIO);
+
+    delete_SkipIndex(index); 
+    delete_List(large); 
+    return EXIT_SUCCESS;
+}
+
+double now(void) {
+    struct timespec ts; 
+    clock_gettime(CLOCK_MONOTONIC, &ts); 
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9; 
+}
+
+// builds a sorted, duplicate-free list with random gaps averaging spread / 2 
+List* buildSorted(int count, int spread) {
+    List* list = new_List(); 
+    int value = 0; 
+    for (int i = 0; i < count; i++) {
+        value += 1 + rand() % spread; 
+        List_append(list, value); 
+    }
+    return list; 
+}
@@ -0,0 +1,194 @@
+/**
+ * @file sortedlist_test.c
+ * @author Joseph Allred 
+ * @brief tests for all methods implemented in sortedlist.c 
+ * @date 2026-10-19 
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "sortedlist.h"
+#include "allocount.h"
+
+List* buildRange(int start, int stop, int step);
+
+int main(int argc, char* argv[]) {
+    List_set_allocator(AllocCount_malloc, AllocCount_free); // count every Node and List 
+
+    //**************************************************************************
+    // TEST: List_insert_sorted, List_is_sorted
+    printf("Test sorted insert:\n");
+    //**************************************************************************
+
+    List* list1 = new_List(); 
+    List_insert_sorted(list1, 5); 
+    List_insert_sorted(list1, 1); 
+    List_insert_sorted(list1, 9); 
+    List_insert_sorted(list1, 3); 
+    if (!List_insert_sorted(list1, 5)) {
+        printf("duplicate 5 was not inserted\n");
+    }
+    printf("list1: ");
+    List_print(list1); 
+    List_append(list1, 12); // tail must still be correct after sorted inserts 
+    if (List_is_sorted(list1) && list1->length == 5) {
+        printf("list1 is sorted with length %d\n", list1->length);
+    }
+    printf("\n");
+
+    //**************************************************************************
+
+
+
+    //**************************************************************************
+    // TEST: List_sort_unique
+    printf("Test sort unique:\n");
+    //**************************************************************************
+
+    List* list2 = new_List(); 
+    int values[] = { 7, 3, 7, 1, 9, 3, 3, 0, -4, 9 }; 
+    for (int i = 0; i < 10; i++) {
+        List_append(list2, values[i]); 
+    }
+    printf("list2 before: ");
+    List_print(list2); 
+    List_sort_unique(list2); 
+    printf("list2 after: ");
+    List_print(list2); 
+    List_append(list2, 10); 
+    if (List_is_sorted(list2) && list2->length == 7) {
+        printf("list2 is sorted with length %d and a valid tail\n", list2->length);
+    }
+    List* list3 = new_List(); 
+    List_sort_unique(list3); // sort empty list 
+    printf("list3: ");
+    List_print(list3); 
+    printf("\n");
+
+    //**************************************************************************
+
+
+
+    //**************************************************************************
+    // TEST: List_intersect, List_union, List_difference by merging 
+    printf("Test set operations:\n");
+    //**************************************************************************
+
+    List* evens = buildRange(0, 20, 2); 
+    List* threes = buildRange(0, 20, 3); 
+    List* both = List_intersect(evens, threes, NULL); 
+    List* either = List_union(evens, threes); 
+    List* onlyEvens = List_difference(evens, threes, NULL); 
+    printf("intersection: ");
+    List_print(both); 
+    printf("union: ");
+    List_print(either); 
+    printf("difference: ");
+    List_print(onlyEvens); 
+    printf("\n");
+
+    //**************************************************************************
+
+
+
+    //**************************************************************************
+    // TEST: new_SkipIndex, List_contains_sorted, galloping set operations 
+    printf("Test galloping:\n");
+    //**************************************************************************
+
+    List* large = buildRange(0, 100000, 3); 
+    List* small = new_List(); 
+    int probes[] = { -5, 0, 4, 299, 300, 301, 50001, 99999, 100002 }; 
+    for (int i = 0; i < 9; i++) {
+        List_append(small, probes[i]); 
+    }
+    SkipIndex* index = new_SkipIndex(large); 
+    printf("index over %d values has %d samples\n", large->length, index->count);
+    if (List_contains_sorted(large, index, 99999) && !List_contains_sorted(large, index, 100000) 
+            && !List_contains_sorted(large, index, -1) && List_contains_sorted(large, NULL, 300)) {
+        printf("contains_sorted finds first, middle and last values only\n");
+    }
+
+    List* galloped = List_intersect(small, large, index); 
+    List* merged = List_intersect(small, large, NULL); 
+    printf("galloped intersection: ");
+    List_print(galloped); 
+    printf("merged intersection:   ");
+    List_print(merged); 
+
+    List* gallopedDiff = List_difference(small, large, index); 
+    List* mergedDiff = List_difference(small, large, NULL); 
+    printf("galloped difference: ");
+    List_print(gallopedDiff); 
+    printf("merged difference:   ");
+    List_print(mergedDiff); 
+
+    List* empty = new_List(); 
+    SkipIndex* emptyIndex = new_SkipIndex(empty); 
+    List* none = List_intersect(empty, large, index); 
+    List* all = List_difference(small, empty, emptyIndex); 
+    if (none->length == 0 && all->length == small->length) {
+        printf("set operations handle empty lists\n");
+    }
+    printf("\n");
+
+    //**************************************************************************
+
+
+
+    //**************************************************************************
+    // TEST: set operations when allocation fails 
+    printf("Test allocation failure:\n");
+    //**************************************************************************
+
+    long before = AllocCount_get().liveBlocks; 
+    AllocCount_fail_after(0); // no result list can be created 
+    List* noList = List_union(evens, threes); 
+    AllocCount_fail_after(3); // result list plus two values, then fail 
+    List* noUnion = List_union(evens, threes); 
+    AllocCount_fail_after(2); 
+    List* noMerge = List_intersect(evens, threes, NULL); 
+    AllocCount_fail_after(2); 
+    List* noGallop = List_difference(small, large, index); 
+    AllocCount_reset(); 
+    if (noList == NULL && noUnion == NULL && noMerge == NULL && noGallop == NULL) {
+        printf("failed set operations return NULL\n");
+    }
+    if (AllocCount_get().liveBlocks == before) {
+        printf("partial results are freed\n");
+    }
+    printf("\n");
+
+    //**************************************************************************
+
+    delete_SkipIndex(index); 
+    delete_SkipIndex(emptyIndex); 
+    delete_List(list1); 
+    delete_List(list2); 
+    delete_List(list3); 
+    delete_List(evens); 
+    delete_List(threes); 
+    delete_List(both); 
+    delete_List(either); 
+    delete_List(onlyEvens); 
+    delete_List(large); 
+    delete_List(small); 
+    delete_List(galloped); 
+    delete_List(merged); 
+    delete_List(gallopedDiff); 
+    delete_List(mergedDiff); 
+    delete_List(empty); 
+    delete_List(none); 
+    delete_List(all); 
+
+    return EXIT_SUCCESS;
+}
+
+List* buildRange(int start, int stop, int step) {
+    List* list = new_List(); 
+    for (int i = start; i < stop; i += step) {
+        List_append(list, i); 
+    }
+    return list; 
+}